@@ -0,0 +1,230 @@
+/*
+ csv_load_bench.cpp
+ Startup benchmark for the CSV loader. It times two ways of turning
+ books.csv and transactions.csv into records:
+   - old: the loop Library::loadFromCSV ran before the memory-mapped
+     loader, copied here: std::getline per line, a std::stringstream per
+     record, std::stoi, and transactions that keep their four dates and
+     status as strings
+   - new: MappedFile + CsvReader (string_views into the mapping) and
+     std::from_chars, with dates parsed to day numbers, as loadFromCSV
+     does now
+ The old loop WAS the whole of the old loadFromCSV, so its time is also
+ the old end-to-end startup. Then the bench times one full
+ Library::loadFromCSV (parsing plus indexes, fines and stats).
+
+ Generate the files first, then build from the repository root (see
+ README.md):
+   python3 bench/make_csv_fixture.py 200000 500000 /tmp/fixture
+
+ Usage: ./csv_load_bench [dir=.] [passes=3] [threads=0]
+   threads is passed to loadFromCSV (0 = one chunk per core)
+*/
+
+#include "Library.h"
+#include "CsvReader.h"
+#include "MappedFile.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+static double millisSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// ==================== OLD LOADER ====================
+
+// The transaction record as it was before dates became day numbers
+struct OldTransaction {
+    int transactionId;
+    int userId;
+    int bookId;
+    std::string checkoutDate;
+    std::string dueDate;
+    std::string returnDate;
+    std::string status;
+
+    OldTransaction(int tid, int uid, int bid,
+                   std::string checkout, std::string due,
+                   std::string returned, std::string stat)
+        : transactionId(tid), userId(uid), bookId(bid),
+          checkoutDate(std::move(checkout)), dueDate(std::move(due)),
+          returnDate(std::move(returned)), status(std::move(stat))
+    {
+        if (tid <= 0) throw std::invalid_argument("Transaction ID must be > 0");
+        if (uid <= 0) throw std::invalid_argument("User ID must be > 0");
+        if (bid <= 0) throw std::invalid_argument("Book ID must be > 0");
+    }
+};
+
+struct OldLoad {
+    std::vector<Book> books;
+    std::vector<OldTransaction> transactions;
+    int nextBookId = 1;
+    int nextTransactionId = 1;
+};
+
+static OldLoad loadOld(const std::string& booksFile, const std::string& transFile) {
+    OldLoad out;
+
+    std::ifstream inb(booksFile);
+    std::string line;
+    while (std::getline(inb, line)) {
+        if (line.empty()) continue;
+
+        std::stringstream ss(line);
+        std::string token;
+
+        int id, total, avail;
+        std::string title, author, isbn;
+
+        std::getline(ss, token, ','); id = std::stoi(token);
+        std::getline(ss, title, ',');
+        std::getline(ss, author, ',');
+        std::getline(ss, isbn, ',');
+        std::getline(ss, token, ','); total = std::stoi(token);
+        std::getline(ss, token, ','); avail = std::stoi(token);
+
+        Book b(id, title, author, isbn, total, avail);
+        out.books.push_back(b);
+
+        out.nextBookId = std::max(out.nextBookId, id + 1);
+    }
+
+    std::ifstream intf(transFile);
+    while (std::getline(intf, line)) {
+        if (line.empty()) continue;
+
+        std::stringstream ss(line);
+        std::string token;
+
+        int tid, uid, bid;
+        std::string checkout, due, returned, status;
+
+        std::getline(ss, token, ','); tid = std::stoi(token);
+        std::getline(ss, token, ','); uid = std::stoi(token);
+        std::getline(ss, token, ','); bid = std::stoi(token);
+        std::getline(ss, checkout, ',');
+        std::getline(ss, due, ',');
+        std::getline(ss, returned, ',');
+        std::getline(ss, status, ',');
+
+        OldTransaction t(tid, uid, bid, checkout, due, returned, status);
+        out.transactions.push_back(t);
+
+        out.nextTransactionId = std::max(out.nextTransactionId, tid + 1);
+    }
+    return out;
+}
+
+// ==================== NEW LOADER ====================
+
+struct NewLoad {
+    std::vector<Book> books;
+    std::vector<Transaction> transactions;
+};
+
+static bool parseDayField(std::string_view field, std::int32_t& day) {
+    if (field.empty()) {
+        day = Transaction::NO_DATE;
+        return true;
+    }
+    Date date;
+    if (!Date::parse(field, date)) return false;
+    day = date.dayNumber();
+    return true;
+}
+
+static NewLoad loadNew(const std::string& booksFile, const std::string& transFile) {
+    NewLoad out;
+    std::string_view f[7];
+    std::size_t n;
+
+    MappedFile inb(booksFile);
+    out.books.reserve(CsvReader::countLines(inb.text()));
+    CsvReader books(inb.text());
+    while (books.next(f, 6, n)) {
+        int id, total, avail;
+        if (n != 6 || !CsvReader::parseInt(f[0], id) || !CsvReader::parseInt(f[4], total)
+            || !CsvReader::parseInt(f[5], avail))
+            continue;
+        out.books.emplace_back(id, std::string(f[1]), std::string(f[2]),
+                               std::string(f[3]), total, avail);
+    }
+
+    MappedFile intf(transFile);
+    out.transactions.reserve(CsvReader::countLines(intf.text()));
+    CsvReader transactions(intf.text());
+    while (transactions.next(f, 7, n)) {
+        int tid, uid, bid;
+        std::int32_t checkout, due, returned;
+        if (n != 7 || !CsvReader::parseInt(f[0], tid) || !CsvReader::parseInt(f[1], uid)
+            || !CsvReader::parseInt(f[2], bid) || !parseDayField(f[3], checkout)
+            || !parseDayField(f[4], due) || !parseDayField(f[5], returned))
+            continue;
+
+        bool known;
+        out.transactions.emplace_back(tid, uid, bid, checkout, due, returned,
+                                      Transaction::parseStatus(f[6], known));
+    }
+    return out;
+}
+
+// ==================== DRIVER ====================
+
+// Best of `passes` runs of load(), in milliseconds; the last result is kept
+template <typename Load, typename Result>
+static double bestOf(int passes, Load load, Result& result) {
+    double best = 0;
+    for (int p = 0; p < passes; ++p) {
+        Clock::time_point start = Clock::now();
+        result = load();
+        double ms = millisSince(start);
+        if (p == 0 || ms < best) best = ms;
+    }
+    return best;
+}
+
+int main(int argc, char** argv) {
+    std::string dir = argc > 1 ? argv[1] : ".";
+    int passes = argc > 2 ? std::atoi(argv[2]) : 3;
+    std::size_t threads = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 0;
+
+    const std::string booksFile = dir + "/books.csv";
+    const std::string transFile = dir + "/transactions.csv";
+    const std::string finesFile = dir + "/fines.csv";
+
+    OldLoad old;
+    NewLoad fresh;
+    double oldMs = bestOf(passes, [&] { return loadOld(booksFile, transFile); }, old);
+    double newMs = bestOf(passes, [&] { return loadNew(booksFile, transFile); }, fresh);
+
+    // Same records: counts, and every due date read both ways
+    bool same = old.books.size() == fresh.books.size()
+             && old.transactions.size() == fresh.transactions.size();
+    for (std::size_t i = 0; same && i < old.transactions.size(); ++i) {
+        Date due;
+        same = Date::parse(old.transactions[i].dueDate, due)
+            && due.dayNumber() == fresh.transactions[i].getDueDay();
+    }
+
+    std::cout << old.books.size() << " books, " << old.transactions.size()
+              << " transactions, best of " << passes << "\n"
+              << "  old loadFromCSV (getline/stringstream/stoi)   " << oldMs << " ms\n"
+              << "  new parsing only (mmap/CsvReader/from_chars)  " << newMs << " ms  ("
+              << oldMs / newMs << "x)" << (same ? "" : "   RESULTS DIFFER") << "\n";
+
+    Clock::time_point start = Clock::now();
+    Library::instance().loadFromCSV(booksFile, transFile, finesFile, threads);
+    std::cout << "  new loadFromCSV (parsing + indexes + stats)   " << millisSince(start)
+              << " ms  (threads=" << threads << ")\n";
+    return 0;
+}
@@ -0,0 +1,67 @@
+#!/usr/bin/env python3
+"""
+make_csv_fixture.py
+Writes a large books.csv / transactions.csv / fines.csv set in the
+library's file format, for the loader benchmarks (csv_load_bench).
+
+Usage: python3 bench/make_csv_fixture.py [books=200000] [transactions=500000] [outdir=.]
+
+Titles never contain commas or quotes, so the old getline/stringstream
+loader that csv_load_bench compares against reads the files correctly.
+"""
+
+import datetime
+import os
+import random
+import sys
+
+WORDS = ["River", "Garden", "Light", "Time", "Night", "Design", "War", "Clean",
+         "Peace", "Data", "Code", "Art", "Stone", "Winter", "Harbor", "Echo"]
+FIRST = ["Ann", "Bob", "Di", "Eve", "Raj", "Mei", "Tom", "Zoe"]
+LAST = ["Lee", "Ray", "Park", "Diaz", "Khan", "Cole", "Ito", "Moss"]
+
+
+def day(d):
+    return d.strftime("%Y-%m-%d")
+
+
+def main():
+    books = int(sys.argv[1]) if len(sys.argv) > 1 else 200000
+    transactions = int(sys.argv[2]) if len(sys.argv) > 2 else 500000
+    outdir = sys.argv[3] if len(sys.argv) > 3 else "."
+    rng = random.Random(1)
+    os.makedirs(outdir, exist_ok=True)
+
+    with open(os.path.join(outdir, "books.csv"), "w") as f:
+        for i in range(1, books + 1):
+            title = " ".join(rng.choice(WORDS) for _ in range(rng.randint(2, 5)))
+            author = rng.choice(FIRST) + " " + rng.choice(LAST)
+            total = rng.randint(1, 8)
+            f.write(f"{i},{title},{author},,{total},{rng.randint(0, total)}\n")
+
+    start = datetime.date(2024, 1, 1)
+    fined = []
+    with open(os.path.join(outdir, "transactions.csv"), "w") as f:
+        for t in range(1, transactions + 1):
+            user = rng.randint(1, 20000)
+            checkout = start + datetime.timedelta(days=rng.randint(0, 600))
+            due = checkout + datetime.timedelta(days=14)
+            kind = rng.random()
+            if kind < 0.1:
+                f.write(f"{t},{user},{rng.randint(1, books)},{day(checkout)},{day(due)},,Active\n")
+                continue
+            returned = checkout + datetime.timedelta(days=rng.randint(1, 18))
+            status = "Returned-Late" if returned > due else "Returned"
+            if returned > due:
+                fined.append((t, user, (returned - due).days))
+            f.write(f"{t},{user},{rng.randint(1, books)},{day(checkout)},{day(due)},"
+                    f"{day(returned)},{status}\n")
+
+    with open(os.path.join(outdir, "fines.csv"), "w") as f:
+        for t, user, late in fined:
+            paid = "Paid" if rng.random() < 0.5 else "Unpaid"
+            f.write(f"{t},{user},{late * 0.5:.2f},{paid}\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,60 @@
+/**
+ AuthorDictionary.h
+ The 'AuthorDictionary' class interns author names. A catalog repeats the
+ same authors over and over, so each distinct name is stored once and
+ books refer to it by a 32-bit author ID. The dictionary also keeps a
+ posting list per author (the sorted IDs of that author's books), which
+ turns "all books by X" into one hash lookup.
+
+ Names are matched exactly (case-sensitive), like BookQuery::authorEquals.
+ An author ID stays valid for the dictionary's lifetime, even after the
+ author's last book is gone.
+ **/
+
+#ifndef AUTHORDICTIONARY_H
+#define AUTHORDICTIONARY_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+class AuthorDictionary {
+public:
+    using AuthorId = std::uint32_t;
+
+    // Returned by find() for a name that was never interned
+    static constexpr AuthorId NO_AUTHOR = 0xFFFFFFFFu;
+
+private:
+    // name -> author ID. The map's nodes never move, so `names` can point
+    // at its keys instead of keeping a second copy of every name.
+    std::unordered_map<std::string, AuthorId> idOf;
+    std::vector<const std::string*> names;      // author ID -> name
+    std::vector<std::vector<int>> postings;     // author ID -> sorted book IDs
+
+public:
+    // ID for a name, adding the name if it is new
+    AuthorId intern(std::string_view name);
+
+    // ID for a name, or NO_AUTHOR if it was never interned
+    AuthorId find(std::string_view name) const;
+
+    // Name of an author ID returned by intern()
+    const std::string& name(AuthorId id) const { return *names[id]; }
+
+    // Posting list maintenance (called by the catalog)
+    void addBook(AuthorId id, int bookId);
+    void removeBook(AuthorId id, int bookId);
+
+    // IDs of the author's books, ascending (empty for NO_AUTHOR)
+    const std::vector<int>& booksBy(AuthorId id) const;
+
+    // Number of distinct names interned so far
+    std::size_t size() const { return names.size(); }
+
+    void clear();
+};
+
+#endif
@@ -0,0 +1,78 @@
+/**
+ AutocompleteIndex.h
+ The 'AutocompleteIndex' class answers type-ahead queries: given a prefix,
+ return the top-k book titles and authors that start with it, ranked by
+ how often their books have been borrowed (circulation count).
+
+ Layout (sorted-array prefix structure):
+ - every distinct lowercase title/author is one Entry
+ - 'order' lists the entries sorted by key, so a prefix is a contiguous range
+ - a max segment tree over 'order' finds the best-ranked entry of any range
+   in O(log n), so the top-k of a range costs O(k log n) however many
+   titles share the prefix
+ New keys are appended unsorted and merged in on the next query, so a bulk
+ load pays for one sort instead of one insertion per book.
+ **/
+
+#ifndef AUTOCOMPLETEINDEX_H
+#define AUTOCOMPLETEINDEX_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+class AutocompleteIndex {
+private:
+    struct Entry {
+        std::string key;           // lowercase text, used for ordering
+        std::string text;          // text as first seen, for display
+        std::vector<int> bookIds;  // books with this title/author
+        long rank = 0;             // summed circulation of those books
+    };
+
+    std::vector<Entry> entries;                       // never moves; empty bookIds = unused
+    std::unordered_map<std::string, std::size_t> slotOf; // key -> index in entries
+    std::unordered_map<int, long> borrowCount;        // bookId -> times borrowed
+
+    std::vector<std::size_t> order;  // entry indexes sorted by key
+    std::size_t sortedCount = 0;     // order[0, sortedCount) is sorted
+    std::vector<std::size_t> posOf;  // entry index -> position in 'order'
+    std::vector<std::size_t> tree;   // segment tree of positions in 'order'
+    std::size_t leafBase = 0;        // first leaf of the tree
+    bool treeValid = false;
+
+    static std::string lowercase(std::string_view s);
+
+    long rankAt(std::size_t pos) const;
+    std::size_t better(std::size_t a, std::size_t b) const;
+    std::size_t bestIn(std::size_t lo, std::size_t hi) const;
+
+    void link(int bookId, std::string_view text);
+    void unlink(int bookId, std::string_view text);
+    void adjustRank(std::string_view text, long delta);
+    void refresh(std::size_t entryIdx);
+    void prepare();
+
+public:
+    // Adds a book's title and author as completions
+    void addBook(int bookId, std::string_view title, std::string_view author);
+
+    // Removes a book; title/author must be the values it was added with
+    void removeBook(int bookId, std::string_view title, std::string_view author);
+
+    // Counts one more loan of this book (raises its title and author)
+    void recordCheckout(int bookId, std::string_view title, std::string_view author);
+
+    /**
+     * complete - Top-k titles/authors starting with prefix (case-insensitive),
+     * most borrowed first; ties are broken alphabetically.
+     */
+    std::vector<std::string> complete(const std::string& prefix, std::size_t k);
+
+    // Drops every entry
+    void clear();
+};
+
+#endif
@@ -68,6 +68,15 @@ public:
     // Sets available copies with validation
     void setAvailableCopies(int available);
 
+    // ==================== VALIDATION ====================
+    // The rules behind the setters, checkout() and returnBook(). They are
+    // static so BookCatalog's book views (BookRef) enforce the same ones.
+
+    static void checkTotalCopies(int total, int available);
+    static void checkAvailableCopies(int available, int total);
+    static void checkCheckout(int available);
+    static void checkReturn(int available, int total);
+
     // ==================== CORE FUNCTIONALITY ====================
 
     // checkout() - Decreases available copies by 1
@@ -82,6 +91,11 @@ public:
 
     bool isAvailable() const { return availableCopies > 0; }
 
+    // matches() - True if the title, author or ISBN contains the keyword
+    // (case-sensitive substring match, as used by the search menus)
+
+    bool matches(const std::string& keyword) const;
+
     // display() - Prints book information to console
     // Formats output for user friendly display
 
@@ -0,0 +1,264 @@
+/**
+ BookCatalog.h
+ The 'BookCatalog' class stores the library's books as a generational
+ slot map over a struct-of-arrays (columnar) layout:
+
+ - hot integer fields (ID, total copies, available copies) live in their
+   own contiguous arrays, so scans and totals read only the bytes they
+   use and the compiler can vectorize the sums
+ - title and ISBN are cold: their characters sit in one shared string
+   pool and each book only stores (offset, length) spans
+ - authors are interned in an AuthorDictionary: each book stores a 32-bit
+   author ID, and the dictionary lists every author's books
+ - each book's ISBN is also kept as a packed 64-bit key (Isbn::NONE when
+   the text is not a valid ISBN) for integer compares and hashing
+ - a BookHandle names a SLOT, which points at the book's dense position
+ - erase() moves the last book into the hole and patches its slot, so
+   removal is O(1) and no other handle changes
+ - each slot has a generation counter bumped on erase; a handle to a
+   removed book no longer matches and resolves to a null BookRef instead
+   of whatever book reuses the slot later
+
+ There is no Book object inside the catalog any more: a BookRef is a
+ Book-compatible view onto one dense position. Dense positions (and so
+ BookRefs) are only stable until the next erase; the string_views handed
+ out by the text getters only until the next insert.
+ **/
+
+#ifndef BOOKCATALOG_H
+#define BOOKCATALOG_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "Book.h"
+#include "AuthorDictionary.h"
+#include "Isbn.h"
+
+// -----------------------------------------------------------------------------
+// BookHandle
+// -----------------------------------------------------------------------------
+// A stable reference to a book in the catalog. A BookRef names a dense
+// position and goes stale as soon as a removal moves books around; a handle
+// survives both growth and removals. Resolve it with Library::resolve()
+// right before use (a null BookRef once the book has been removed).
+// -----------------------------------------------------------------------------
+
+struct BookHandle {
+    static constexpr std::uint32_t NO_SLOT = 0xFFFFFFFFu;
+
+    std::uint32_t slot = NO_SLOT;
+    std::uint32_t generation = 0;
+
+    bool isNull() const { return slot == NO_SLOT; }
+};
+
+class BookCatalog;
+
+// -----------------------------------------------------------------------------
+// BookRef
+// -----------------------------------------------------------------------------
+// A view of one book in the catalog with the same getters, setters and
+// operations as Book (same validation, same exceptions). It is cheap to copy
+// and behaves like the Book* it replaces: it can be null (test it with
+// `if (ref)`), and `ref->getTitle()` works as well as `ref.getTitle()`.
+// Text getters return string_views into the catalog's string pool.
+// -----------------------------------------------------------------------------
+
+class BookRef {
+private:
+    BookCatalog* catalog = nullptr;
+    std::size_t pos = 0;
+
+public:
+    BookRef() = default;
+    BookRef(BookCatalog* c, std::size_t p) : catalog(c), pos(p) {}
+
+    explicit operator bool() const { return catalog != nullptr; }
+
+    // Pointer-style access, so code written against Book* keeps working
+    BookRef* operator->() { return this; }
+    const BookRef* operator->() const { return this; }
+
+    bool operator==(const BookRef& o) const {
+        return catalog == o.catalog && pos == o.pos;
+    }
+    bool operator!=(const BookRef& o) const { return !(*this == o); }
+
+    // Dense position in the catalog
+    std::size_t position() const { return pos; }
+
+    // ==================== GETTERS ====================
+
+    int getBookId() const;
+    std::string_view getTitle() const;
+    std::string_view getAuthor() const;
+    AuthorDictionary::AuthorId getAuthorId() const;
+    std::string_view getIsbn() const;
+    Isbn::Key getIsbnKey() const;
+    int getTotalCopies() const;
+    int getAvailableCopies() const;
+
+    bool isAvailable() const { return getAvailableCopies() > 0; }
+
+    // ==================== SETTERS ====================
+    // Title, author and ISBN can't be edited in place: Library's search
+    // and ISBN indexes are keyed on them and would silently go stale.
+
+    // Same validation as Book::setTotalCopies / Book::setAvailableCopies
+    void setTotalCopies(int total);
+    void setAvailableCopies(int available);
+
+    // ==================== CORE FUNCTIONALITY ====================
+
+    // Same rules as Book::checkout / Book::returnBook
+    void checkout();
+    void returnBook();
+
+    // Same match as Book::matches (title, author or ISBN contains keyword)
+    bool matches(std::string_view keyword) const;
+
+    // Copy of the book as a standalone Book
+    Book toBook() const;
+
+    void display() const;
+    std::string toCSV() const;
+};
+
+class BookCatalog {
+private:
+    friend class BookRef;
+
+    struct Slot {
+        std::uint32_t index;       // dense position, or next free slot when free
+        std::uint32_t generation;  // bumped every time the slot is freed
+    };
+
+    // Where a book's text lives in `textPool`
+    struct TextSpan {
+        std::uint32_t offset;
+        std::uint32_t length;
+    };
+
+    std::vector<Slot> slots;
+    std::vector<std::uint32_t> denseToSlot;  // owner slot of each dense book
+    std::uint32_t freeHead = BookHandle::NO_SLOT;
+
+    // -------- Hot columns (one entry per dense position) --------
+    std::vector<int> ids;
+    std::vector<int> totalCopies;
+    std::vector<int> availableCopies;
+
+    // -------- Cold columns --------
+    std::vector<TextSpan> titles;
+    std::vector<TextSpan> isbns;
+    std::vector<Isbn::Key> isbnKeys;
+    std::vector<AuthorDictionary::AuthorId> authorIds;
+    AuthorDictionary authorDict;
+    std::string textPool;
+    std::size_t deadTextBytes = 0;  // pool bytes no span points at any more
+
+    bool isLive(BookHandle h) const;
+
+    TextSpan appendText(std::string_view s);
+    void releaseText(TextSpan span);
+    void compactText();
+
+    std::string_view textOf(TextSpan span) const {
+        return std::string_view(textPool.data() + span.offset, span.length);
+    }
+
+public:
+    // Iterates the dense positions, yielding a BookRef for each
+    class iterator {
+    private:
+        BookCatalog* catalog;
+        std::size_t pos;
+
+    public:
+        iterator(BookCatalog* c, std::size_t p) : catalog(c), pos(p) {}
+
+        BookRef operator*() const { return BookRef(catalog, pos); }
+        iterator& operator++() { ++pos; return *this; }
+        bool operator==(const iterator& o) const { return pos == o.pos; }
+        bool operator!=(const iterator& o) const { return pos != o.pos; }
+    };
+
+    // Adds a book in O(1) (amortized) and returns its handle
+    BookHandle insert(const Book& b);
+
+    // Same, straight from the fields (no Book, no string copies). The
+    // caller has already validated them the way Book's constructor does.
+    BookHandle insert(int id, std::string_view title, std::string_view author,
+                      std::string_view isbn, int total, int available);
+
+    // Removes a book in O(1); false if the handle is null or stale
+    bool erase(BookHandle h);
+
+    // Book for a handle, null BookRef if null or stale
+    BookRef get(BookHandle h);
+    BookRef get(BookHandle h) const;
+
+    // Dense position of a live handle (for ordering), or size() if stale
+    std::size_t positionOf(BookHandle h) const;
+
+    // Handle of the book at a dense position
+    BookHandle handleAt(std::size_t pos) const;
+
+    // Interned author names and each author's book IDs
+    const AuthorDictionary& authors() const { return authorDict; }
+
+    // ==================== DENSE ACCESS ====================
+
+    // The catalog is one shared store, so a view from a const catalog can
+    // still write through; the const overloads exist for read-only scans
+    BookRef operator[](std::size_t pos) { return BookRef(this, pos); }
+    BookRef operator[](std::size_t pos) const {
+        return BookRef(const_cast<BookCatalog*>(this), pos);
+    }
+
+    std::size_t size() const { return ids.size(); }
+    bool empty() const { return ids.empty(); }
+
+    iterator begin() const { return iterator(const_cast<BookCatalog*>(this), 0); }
+    iterator end() const { return iterator(const_cast<BookCatalog*>(this), size()); }
+
+    // ==================== COLUMN AGGREGATES ====================
+    // Sums over dense positions [begin, end). Plain loops over int arrays,
+    // which the compiler turns into SIMD adds.
+
+    long sumTotalCopies(std::size_t begin, std::size_t end) const;
+    long sumAvailableCopies(std::size_t begin, std::size_t end) const;
+
+    // Largest book ID in [begin, end), 0 if the range is empty
+    int maxId(std::size_t begin, std::size_t end) const;
+
+    void reserve(std::size_t n);
+    void clear();
+};
+
+// ==================== BOOKREF HOT GETTERS ====================
+
+inline int BookRef::getBookId() const { return catalog->ids[pos]; }
+inline int BookRef::getTotalCopies() const { return catalog->totalCopies[pos]; }
+inline int BookRef::getAvailableCopies() const { return catalog->availableCopies[pos]; }
+
+inline std::string_view BookRef::getTitle() const {
+    return catalog->textOf(catalog->titles[pos]);
+}
+inline std::string_view BookRef::getAuthor() const {
+    return catalog->authorDict.name(catalog->authorIds[pos]);
+}
+inline Isbn::Key BookRef::getIsbnKey() const {
+    return catalog->isbnKeys[pos];
+}
+inline AuthorDictionary::AuthorId BookRef::getAuthorId() const {
+    return catalog->authorIds[pos];
+}
+inline std::string_view BookRef::getIsbn() const {
+    return catalog->textOf(catalog->isbns[pos]);
+}
+
+#endif
@@ -0,0 +1,74 @@
+/**
+ BookCursor.h
+ The 'BookCursor' class walks search results lazily, one page at a time.
+ Nothing is materialized up front: each nextPage() call scans only as far
+ as it needs to fill the page, so the first page of a broad query ("a")
+ comes back after a handful of books and memory stays bounded by the page
+ size no matter how many books match.
+
+ With an index, the cursor keeps at most MAX_CANDIDATES candidate
+ positions; a broader query falls back to the lazy scan, so building a
+ cursor never costs more than that bound.
+
+ token() is a continuation token: a cursor created later for the same
+ query and resumed with resume(token) continues where this one stopped.
+ A cursor (and its tokens) is only valid until the catalog is modified.
+ **/
+
+#ifndef BOOKCURSOR_H
+#define BOOKCURSOR_H
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+#include "BookCatalog.h"
+
+class Library;
+
+class BookCursor {
+public:
+    using Predicate = std::function<bool(const BookRef&)>;
+
+    // Page size used by the search menus
+    static constexpr std::size_t DEFAULT_PAGE_SIZE = 10;
+
+    // Most index candidates a cursor takes; past this it scans instead
+    static constexpr std::size_t MAX_CANDIDATES = 4096;
+
+private:
+    Library* lib;
+    Predicate pred;
+
+    // With candidates: ascending catalog positions to verify (from an index).
+    // Without: every catalog position is checked in order.
+    bool useCandidates;
+    std::vector<std::size_t> candidates;
+
+    std::size_t next = 0;  // next step to check (catalog or candidate index)
+
+    std::size_t stepCount() const;
+    BookRef bookAt(std::size_t step) const;
+    bool seekMatch();
+
+public:
+    // Scans the whole catalog with a predicate
+    BookCursor(Library& library, Predicate p);
+
+    // Only checks the given catalog positions (must be ascending)
+    BookCursor(Library& library, Predicate p,
+               std::vector<std::size_t> candidatePositions);
+
+    // Next (up to) limit matches; empty once the cursor is exhausted
+    std::vector<BookRef> nextPage(std::size_t limit = DEFAULT_PAGE_SIZE);
+
+    // True if another match exists (looks ahead to it without consuming)
+    bool hasMore();
+
+    // Continuation token for the next page
+    std::size_t token() const { return next; }
+
+    // Continue from a token returned by token()
+    void resume(std::size_t tokenValue) { next = tokenValue; }
+};
+
+#endif
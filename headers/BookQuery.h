@@ -0,0 +1,71 @@
+/**
+ BookQuery.h
+ The 'BookQuery' class is a small, composable book filter. Unlike the opaque
+ lambda passed to Library::searchBooks, a BookQuery can be inspected, so
+ Library::runQuery can answer it from an index instead of scanning.
+
+ Example - available books by Robert C. Martin:
+   BookQuery q = BookQuery::authorEquals("Robert C. Martin")
+              && BookQuery::availableOnly();
+   auto results = Library::instance().runQuery(q);
+ **/
+
+#ifndef BOOKQUERY_H
+#define BOOKQUERY_H
+
+#include <string>
+#include <vector>
+#include "BookCatalog.h"
+#include "Isbn.h"
+
+class BookQuery {
+public:
+    enum class Kind {
+        TitleContains,  // title contains text (case-sensitive)
+        AuthorEquals,   // author is exactly text
+        IsbnEquals,     // same ISBN as text (by key if text is a valid ISBN)
+        AvailableOnly,  // at least one copy on the shelf
+        IdRange,        // lo <= bookId <= hi
+        And,            // every child matches
+        Or              // at least one child matches
+    };
+
+private:
+    Kind kind;
+    std::string text;
+    Isbn::Key isbnKey = Isbn::NONE;  // IsbnEquals: packed form of text
+    int lo = 0;
+    int hi = 0;
+    std::vector<BookQuery> children;
+
+    explicit BookQuery(Kind k) : kind(k) {}
+
+public:
+    // ==================== BUILDERS ====================
+
+    static BookQuery titleContains(const std::string& text);
+    static BookQuery authorEquals(const std::string& author);
+    static BookQuery isbnEquals(const std::string& isbn);
+    static BookQuery availableOnly();
+    static BookQuery idRange(int lo, int hi);
+
+    // Combine two queries (nested ANDs/ORs are flattened)
+    BookQuery operator&&(const BookQuery& other) const;
+    BookQuery operator||(const BookQuery& other) const;
+
+    // ==================== GETTERS ====================
+
+    Kind getKind() const { return kind; }
+    const std::string& getText() const { return text; }
+    Isbn::Key getIsbnKey() const { return isbnKey; }
+    int getLo() const { return lo; }
+    int getHi() const { return hi; }
+    const std::vector<BookQuery>& getChildren() const { return children; }
+
+    // ==================== EVALUATION ====================
+
+    // matches() - Evaluates the query against one book (no index use)
+    bool matches(const BookRef& b) const;
+};
+
+#endif
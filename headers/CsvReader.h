@@ -0,0 +1,109 @@
+/**
+ CsvReader.h
+ The 'CsvReader' class walks the records of a CSV buffer (usually a
+ MappedFile's text) without copying it. Fields are string_views that
+ point straight into the buffer, and numbers are converted with
+ std::from_chars, which neither allocates nor throws.
+
+ Quoting follows RFC 4180: a field wrapped in double quotes may contain
+ commas, line breaks and doubled quotes (""), so any title written by
+ CsvWriter reads back unchanged. Only a quoted field that holds a
+ doubled quote is copied (unescaped into a per-record scratch buffer);
+ every other field stays a view into the buffer.
+
+ Parsing is lenient: a quote opens a quoted field only as the field's
+ first character. Anywhere else it is plain text, so an unescaped quote
+ in an older file (12" Singles) stays in its field instead of swallowing
+ the rest of the record.
+
+ Records are found simdcsv-style: each 64-byte window is classified into
+ quote / comma / newline bitmasks (AVX2, SSE2 or scalar, picked like
+ SimdScan's kernels), a prefix XOR of the quotes that open, close or
+ escape a quoted field marks the bytes inside quotes, and the remaining
+ comma and newline bits are the field and record boundaries.
+
+ The reader tracks the 1-based line number where the current record
+ starts so the loader can name the exact line when a record is
+ malformed. Blank lines are skipped and a trailing '\r' (Windows line
+ endings) is dropped.
+
+ Example:
+   CsvReader reader(file.text());
+   std::string_view fields[6];
+   std::size_t n;
+   while (reader.next(fields, 6, n)) {
+       int id;
+       if (n != 6 || !CsvReader::parseInt(fields[0], id))
+           std::cerr << "line " << reader.lineNumber() << ": bad record\n";
+   }
+ **/
+
+#ifndef CSVREADER_H
+#define CSVREADER_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class CsvReader {
+private:
+    std::string_view buffer;
+    std::size_t pos = 0;
+    std::size_t line = 0;      // line number of the last record returned
+    std::size_t linesRead = 0; // line breaks consumed so far
+    std::string scratch;       // unescaped quoted fields of the current record
+
+public:
+    explicit CsvReader(std::string_view text) : buffer(text) {}
+
+    /**
+     * next - Splits the next non-blank record into fields.
+     * Up to maxFields views are written to `fields`; `count` is the number
+     * of fields the record really has (more than maxFields means extra
+     * commas, the surplus is not stored). The views stay valid until the
+     * next call. False at the end of the buffer.
+     */
+    bool next(std::string_view* fields, std::size_t maxFields, std::size_t& count);
+
+    // 1-based line number where the record last returned by next() starts;
+    // once next() has returned false, the number of lines in the buffer
+    std::size_t lineNumber() const { return line; }
+
+    // Number of newline-terminated lines (plus a final unterminated one),
+    // for reserving containers before the real pass
+    static std::size_t countLines(std::string_view text);
+
+    /**
+     * splitLines - Cuts text into at most `parts` consecutive chunks that
+     * each end just after a record's line break (the last one at the end
+     * of the text). Line breaks inside quoted fields are never used, so
+     * every record lies wholly inside one chunk and each chunk can get its
+     * own CsvReader. Small texts come back as a single chunk.
+     */
+    static std::vector<std::string_view> splitLines(std::string_view text, std::size_t parts);
+
+    // Whole field as a decimal int (optional '-'); false for anything else
+    static bool parseInt(std::string_view field, int& out);
+};
+
+// -----------------------------------------------------------------------------
+// CsvWriter
+// -----------------------------------------------------------------------------
+// The matching writer: fields holding a comma, quote or line break are
+// quoted and their quotes doubled; everything else is written as is.
+// -----------------------------------------------------------------------------
+
+class CsvWriter {
+public:
+    // True if the field must be quoted to read back unchanged
+    static bool needsQuotes(std::string_view field);
+
+    // Appends one field, escaped if needed
+    static void appendField(std::string& out, std::string_view field);
+
+    // One field, escaped if needed
+    static std::string escape(std::string_view field);
+};
+
+#endif
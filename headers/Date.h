@@ -0,0 +1,184 @@
+/**
+ Date.h
+ The 'Date' class is the library's one calendar date type: a day number
+ (days since 1970-01-01, proleptic Gregorian calendar) with exact
+ conversion to and from year/month/day.
+
+ - days_from_civil / civil_from_days (H. Hinnant's algorithms) are exact
+   across month ends and leap years, unlike a 365/30-day approximation
+ - date math needs no mktime or time zones (only today() reads the
+   local clock): differences are plain subtraction
+ - parse() and format() never allocate, and everything except today()
+   and toString() is constexpr
+
+ Example:
+   Date checkout, returned;
+   Date::parse("2025-12-5", checkout);
+   Date::parse("2026-01-02", returned);
+   Date due = checkout.plusDays(14);    // 2025-12-19
+   int late = returned - due;           // 14
+ **/
+
+#ifndef DATE_H
+#define DATE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+class Date {
+public:
+    struct Civil {
+        int year;
+        int month;  // 1-12
+        int day;    // 1-31
+    };
+
+private:
+    std::int32_t days;  // days since 1970-01-01
+
+    // Reads 1..maxDigits digits at s[i]; false if there are none
+    static constexpr bool readNumber(std::string_view s, std::size_t& i,
+                                     std::size_t maxDigits, int& out)
+    {
+        std::size_t start = i;
+        out = 0;
+        while (i < s.size() && i - start < maxDigits && s[i] >= '0' && s[i] <= '9')
+            out = out * 10 + (s[i++] - '0');
+        return i > start;
+    }
+
+public:
+    // Length of the text format() writes ("YYYY-MM-DD")
+    static constexpr std::size_t TEXT_LENGTH = 10;
+
+    // ==================== CONSTRUCTORS ====================
+
+    constexpr Date() : days(0) {}
+    constexpr explicit Date(std::int32_t dayNumber) : days(dayNumber) {}
+    constexpr Date(int year, int month, int day)
+        : days(daysFromCivil(year, month, day)) {}
+
+    // ==================== CALENDAR MATH ====================
+
+    static constexpr bool isLeapYear(int y) {
+        return (y % 4 == 0 && y % 100 != 0) || y % 400 == 0;
+    }
+
+    static constexpr int daysInMonth(int y, int m) {
+        return m == 2 ? (isLeapYear(y) ? 29 : 28)
+             : (m == 4 || m == 6 || m == 9 || m == 11) ? 30 : 31;
+    }
+
+    static constexpr bool isValid(int y, int m, int d) {
+        return m >= 1 && m <= 12 && d >= 1 && d <= daysInMonth(y, m);
+    }
+
+    // Days from 1970-01-01 to y-m-d. Years run March-February, so the
+    // leap day is the last day of the year, and 400-year eras repeat.
+    static constexpr std::int32_t daysFromCivil(int y, int m, int d) {
+        y -= m <= 2;
+        const int era = (y >= 0 ? y : y - 399) / 400;
+        const int yoe = y - era * 400;                                  // [0, 399]
+        const int doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;  // [0, 365]
+        const int doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;           // [0, 146096]
+        return era * 146097 + doe - 719468;
+    }
+
+    // Inverse of daysFromCivil
+    static constexpr Civil civilFromDays(std::int32_t z) {
+        z += 719468;
+        const int era = (z >= 0 ? z : z - 146096) / 146097;
+        const int doe = z - era * 146097;                                 // [0, 146096]
+        const int yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+        const int doy = doe - (365 * yoe + yoe / 4 - yoe / 100);          // [0, 365]
+        const int mp = (5 * doy + 2) / 153;                               // [0, 11]
+        const int d = doy - (153 * mp + 2) / 5 + 1;
+        const int m = mp + (mp < 10 ? 3 : -9);
+        return Civil{yoe + era * 400 + (m <= 2), m, d};
+    }
+
+    // ==================== PARSE / FORMAT ====================
+
+    /**
+     * parse - Reads "YYYY-MM-DD" (month and day may be one digit).
+     * Returns false, leaving `out` alone, if the text has any other shape
+     * or is not a real calendar date ("2025-02-30").
+     */
+    static constexpr bool parse(std::string_view s, Date& out) {
+        std::size_t i = 0;
+        int y = 0, m = 0, d = 0;
+
+        bool ok = readNumber(s, i, 4, y)
+               && i < s.size() && s[i++] == '-'
+               && readNumber(s, i, 2, m)
+               && i < s.size() && s[i++] == '-'
+               && readNumber(s, i, 2, d)
+               && i == s.size()
+               && isValid(y, m, d);
+
+        if (ok) out = Date(y, m, d);
+        return ok;
+    }
+
+    /**
+     * format - Writes "YYYY-MM-DD" (TEXT_LENGTH chars, no terminator) to
+     * buf and returns the length. Years outside 0-9999 are clamped.
+     */
+    constexpr std::size_t format(char* buf) const {
+        Civil c = civil();
+        int y = c.year < 0 ? 0 : (c.year > 9999 ? 9999 : c.year);
+
+        buf[0] = static_cast<char>('0' + y / 1000);
+        buf[1] = static_cast<char>('0' + y / 100 % 10);
+        buf[2] = static_cast<char>('0' + y / 10 % 10);
+        buf[3] = static_cast<char>('0' + y % 10);
+        buf[4] = '-';
+        buf[5] = static_cast<char>('0' + c.month / 10);
+        buf[6] = static_cast<char>('0' + c.month % 10);
+        buf[7] = '-';
+        buf[8] = static_cast<char>('0' + c.day / 10);
+        buf[9] = static_cast<char>('0' + c.day % 10);
+        return TEXT_LENGTH;
+    }
+
+    std::string toString() const;
+
+    // ==================== BATCH ====================
+
+    /**
+     * daysLate - out[i] = days from due[i] to returned[i], or 0 if the
+     * return was on time or either day is `missing`. Works on plain day
+     * number columns without branches, so the loop vectorizes.
+     */
+    static void daysLate(const std::int32_t* due, const std::int32_t* returned,
+                         std::size_t n, std::int32_t missing, std::int32_t* out);
+
+    // Today's date in the local time zone
+    static Date today();
+
+    // ==================== ACCESSORS / ARITHMETIC ====================
+
+    constexpr std::int32_t dayNumber() const { return days; }
+    constexpr Civil civil() const { return civilFromDays(days); }
+
+    constexpr Date plusDays(int n) const { return Date(days + n); }
+
+    // Signed number of days from `other` to this date
+    constexpr int operator-(const Date& other) const { return days - other.days; }
+
+    constexpr bool operator==(const Date& o) const { return days == o.days; }
+    constexpr bool operator!=(const Date& o) const { return days != o.days; }
+    constexpr bool operator<(const Date& o) const { return days < o.days; }
+    constexpr bool operator<=(const Date& o) const { return days <= o.days; }
+    constexpr bool operator>(const Date& o) const { return days > o.days; }
+    constexpr bool operator>=(const Date& o) const { return days >= o.days; }
+};
+
+// Compile-time checks of the conversions
+static_assert(Date(1970, 1, 1).dayNumber() == 0, "epoch");
+static_assert(Date(2000, 3, 1) - Date(2000, 2, 28) == 2, "leap day");
+static_assert(Date(2025, 12, 5).plusDays(30).civil().month == 1, "year end");
+
+#endif
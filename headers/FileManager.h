@@ -7,10 +7,14 @@ class FileManager {
 private:
     std::string booksfile;
     std::string transfile;
+    std::string finesfile;
+    std::string snapfile;
 
 public:
     FileManager(const std::string& books = "books.csv",
-                const std::string& trans = "transactions.csv");
+                const std::string& trans = "transactions.csv",
+                const std::string& fines = "fines.csv",
+                const std::string& snap = "library.snap");
 
     // load all data
     void loaddata();
@@ -2,24 +2,41 @@
 #define FINE_H
 // this class represents a monetary fine in the system
 // it basically charges a penalty of $.50 per each day (late) they take to return the book.
+// the amount is kept in whole cents (Money) so adding fines up never loses a penny,
+// and each fine remembers which user and which transaction it was charged for.
 
 #include <string>   // for string return type
-#include <sstream>  // for converting amount to string
-#include <iomanip>  // for formatting decimal places
+#include "Money.h"  // exact cents amount
 
 
 // Represents a monetary fine in the system
 class Fine {
-    double amount = 0.0; // stores the fine amount
+    Money amount;          // stores the fine amount
+    int userId = 0;        // who was charged (0 = not linked to a user)
+    int transactionId = 0; // the loan it was charged for (0 = none)
 
 public:
+    // the one late rate used everywhere: $0.50 per day late
+    static constexpr Money PER_DAY = Money::fromCents(50);
+
+    // fine for returning a book daysLate days late ($0.00 if on time)
+    static constexpr Money forDaysLate(int daysLate) {
+        return daysLate > 0 ? PER_DAY * daysLate : Money();
+    }
+
     Fine() = default; // default constructor when there is $0.00 
 
 //Marked "explicit" to prevent implicit conversions
-//from double to Fine because if it does it would not compile.
-    explicit Fine(double amount_); // create fine with a set amount
+//from Money to Fine.
+    explicit Fine(Money amount_); // create fine with a set amount
+
+    // create a fine charged to a user for one transaction
+    Fine(int userId_, int transactionId_, Money amount_);
+
+    Money getAmount() const; // returns fine amount
+    int getUserId() const;
+    int getTransactionId() const;
 
-    double getAmount() const; // returns fine amount
     Fine operator+(const Fine& other) const; // allows adding fines together
     std:: string toString() const; // returns fine amount as a formatted string
 };
@@ -0,0 +1,105 @@
+/**
+ FineLedger.h
+ The 'FineLedger' class records every fine the library charges, keyed by
+ user and by transaction.
+
+ - amounts are stored as one contiguous column of cents, so total() is a
+   single exact pass over the whole ledger
+ - each user's outstanding (unpaid) balance is a running total: O(1)
+ - a transaction has at most one fine, found in O(1)
+ - fines.csv holds one self-contained line per fine, in charge order
+   ("transactionId,userId,amount,Paid|Unpaid"), so a new fine is one
+   appended line and loading is a single streaming pass
+
+ Example:
+   FineLedger ledger;
+   ledger.charge(Fine(7, 42, Fine::forDaysLate(18)));  // user 7 owes $9.00
+   ledger.outstanding(7);                              // 9.00
+   ledger.settle(42);                                  // paid
+   ledger.outstanding(7);                              // 0.00
+ **/
+
+#ifndef FINELEDGER_H
+#define FINELEDGER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "Fine.h"
+
+class FineLedger {
+    // One entry per fine, as parallel columns (entry i = row i)
+    std::vector<std::int64_t> cents;
+    std::vector<int> userIds;
+    std::vector<int> transactionIds;
+    std::vector<std::uint8_t> paid;
+
+    // userId -> unpaid cents; transactionId -> entry
+    std::unordered_map<int, std::int64_t> balances;
+    std::unordered_map<int, std::size_t> byTransaction;
+
+    std::int64_t unpaidCents = 0;
+
+public:
+    /**
+     * charge - Records a fine (unpaid) and adds it to the user's balance.
+     * A transaction can only be fined once: throws invalid_argument if
+     * the fine's transaction ID (when non-zero) already has one.
+     */
+    void charge(const Fine& fine);
+
+    // Records a fine that was already paid (does not touch balances)
+    void chargePaid(const Fine& fine);
+
+    // Marks a transaction's fine paid. False if it has none or it was paid.
+    bool settle(int transactionId);
+
+    // Unpaid balance of one user, O(1)
+    Money outstanding(int userId) const;
+
+    // Unpaid balance of every user together
+    Money outstandingTotal() const { return Money::fromCents(unpaidCents); }
+
+    // Sum of every fine ever charged (paid or not)
+    Money total() const;
+
+    // Fine charged for a transaction; false if there is none
+    bool findByTransaction(int transactionId, Fine& out) const;
+
+    // ==================== ENTRIES ====================
+
+    std::size_t size() const { return cents.size(); }
+    bool empty() const { return cents.empty(); }
+
+    Fine operator[](std::size_t i) const {
+        return Fine(userIds[i], transactionIds[i], Money::fromCents(cents[i]));
+    }
+
+    bool isPaid(std::size_t i) const { return paid[i] != 0; }
+
+    // ==================== FILE RECORDS ====================
+
+    // Entry i as one fines.csv line (no newline)
+    std::string toCSV(std::size_t i) const;
+
+    // Number of fields in a fines.csv record
+    static constexpr std::size_t CSV_FIELDS = 4;
+
+    /**
+     * addFromCSV - Adds one fines.csv record, already split into fields
+     * (paid or unpaid, as recorded). Returns false, adding nothing, if
+     * the record is malformed; throws invalid_argument like charge() if
+     * the transaction is already fined.
+     */
+    bool addFromCSV(const std::string_view* fields, std::size_t count);
+
+    void clear();
+
+private:
+    void append(const Fine& fine, bool isPaid);
+};
+
+#endif
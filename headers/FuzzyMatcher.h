@@ -0,0 +1,45 @@
+/**
+ FuzzyMatcher.h
+ The 'FuzzyMatcher' class measures how closely a pattern occurs inside a text:
+ the smallest edit distance (insertions, deletions, substitutions) between
+ the pattern and ANY substring of the text. "Switf UI" occurs in
+ "iOS development with Swift UI" at distance 2.
+
+ Patterns up to 64 characters use Myers' bit-parallel algorithm: the whole
+ DP column is packed into one 64-bit word and advanced with a handful of
+ bitwise operations per text character, instead of m cell updates.
+ Matching is case-insensitive.
+ **/
+
+#ifndef FUZZYMATCHER_H
+#define FUZZYMATCHER_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class FuzzyMatcher {
+private:
+    std::string pattern;            // lowercased
+    std::uint64_t peq[256] = {};    // bit i set where pattern[i] == c
+
+    int bitParallelDistance(std::string_view text) const;
+    int dynamicProgrammingDistance(std::string_view text) const;
+
+public:
+    // Longest pattern handled by the bit-parallel kernel
+    static constexpr std::size_t WORD_BITS = 64;
+
+    explicit FuzzyMatcher(const std::string& pat);
+
+    std::size_t length() const { return pattern.size(); }
+
+    /**
+     * distance - Best edit distance of the pattern against any substring
+     * of text. An empty pattern is at distance 0 from everything.
+     */
+    int distance(std::string_view text) const;
+};
+
+#endif
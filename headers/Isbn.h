@@ -0,0 +1,41 @@
+/**
+ Isbn.h
+ The 'Isbn' class validates ISBNs and packs them into 64-bit keys.
+
+ Both ISBN-10 and ISBN-13 are accepted; hyphens and spaces are ignored and
+ the check digit must be correct. An ISBN-10 is converted to its ISBN-13
+ form ("978" prefix), so both spellings of one book give the same key.
+ The key is simply the 13-digit number, which needs 44 bits: comparing
+ and hashing it is one integer operation instead of a string compare.
+
+ Example: "0-13-235088-2" and "9780132350884" -> 9780132350884
+ **/
+
+#ifndef ISBN_H
+#define ISBN_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+class Isbn {
+public:
+    using Key = std::uint64_t;
+
+    // Key of an empty, malformed or wrong-checksum ISBN
+    static constexpr Key NONE = 0;
+
+    /**
+     * parse - Packed key of an ISBN-10 or ISBN-13, or NONE if the text is
+     * not one (wrong length, stray characters or bad check digit).
+     * One pass over the characters, no allocation.
+     */
+    static Key parse(std::string_view text);
+
+    static bool isValid(std::string_view text) { return parse(text) != NONE; }
+
+    // Canonical text of a key: the 13 digits, no hyphens
+    static std::string toString(Key key);
+};
+
+#endif
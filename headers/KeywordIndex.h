@@ -0,0 +1,48 @@
+/**
+ KeywordIndex.h
+ The 'KeywordIndex' class is an inverted index over book titles and authors.
+ Every word (lowercased run of letters and digits) maps to a posting list:
+ the sorted IDs of the books whose title or author contains that word.
+ A keyword query intersects the posting lists of its words, so it only
+ touches the books that can actually match.
+ **/
+
+#ifndef KEYWORDINDEX_H
+#define KEYWORDINDEX_H
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+class KeywordIndex {
+private:
+    // word -> sorted, duplicate-free book IDs
+    std::unordered_map<std::string, std::vector<int>> postings;
+
+public:
+    /**
+     * tokenize - Splits text into lowercase words (letters and digits only)
+     * Duplicates are removed, so each word is returned once.
+     * Example: "Clean Code: Clean!" -> { "clean", "code" }
+     */
+    static std::vector<std::string> tokenize(std::string_view text);
+
+    // Adds a book's title and author words to the index
+    void addBook(int bookId, std::string_view title, std::string_view author);
+
+    // Removes a book; title/author must be the values it was added with
+    void removeBook(int bookId, std::string_view title, std::string_view author);
+
+    /**
+     * search - Returns the IDs of books containing EVERY word of the query
+     * in their title or author, in ascending ID order.
+     * An empty query (no words) matches nothing.
+     */
+    std::vector<int> search(const std::string& query) const;
+
+    // Drops every posting list
+    void clear();
+};
+
+#endif
@@ -15,6 +15,7 @@
 #include "User.h"
 #include "Book.h"
 #include "Transaction.h"
+#include "Fine.h"
 #include <vector>
 #include <string>
 
@@ -24,7 +25,8 @@ class Librarian : public User
 private:
     // FINE_PER_DAY - The late fee charged per day overdue $0.50 per day
 
-    static constexpr double FINE_PER_DAY = 0.50;
+    // (the one rate from Fine, also used by Library::processReturn)
+    static constexpr Money FINE_PER_DAY = Fine::PER_DAY;
 
     static constexpr int DEFAULT_LOAN_PERIOD = 14;
 
@@ -62,6 +64,7 @@ public:
      * - Processing returns
      * - Viewing all transactions
      * - Generating reports
+     * - Recording fine payments
      */
     void menu() override;
 
@@ -107,7 +110,7 @@ public:
      *   calculateFine(5) = $2.50
      *   calculateFine(18) = $9.00
      */
-    double calculateFine(int daysLate) const;
+    Money calculateFine(int daysLate) const;
 
     /**
      * viewAllTransactions - Displays all transaction records
@@ -125,6 +128,19 @@ public:
      */
     void generateReport() const;
 
+    /**
+     * recordFinePayment - Marks a transaction's fine as paid
+     * 1. Get transaction ID from input
+     * 2. Settle its fine in the ledger
+     * 3. Show the borrower's remaining balance
+     *
+     * Edge Cases Handled:
+     * - No fine for that transaction
+     * - Fine already paid
+     * - Invalid input
+     */
+    void recordFinePayment();
+
     // ==================== DESTRUCTOR ====================
     ~Librarian() override = default;
 };
@@ -2,10 +2,88 @@
 #define LIBRARY_H
 
 #include <vector>
+#include <set>
 #include <string>
-#include "Book.h"
+#include <unordered_map>
+#include <utility>
+#include "BookCatalog.h"
+#include "Isbn.h"
+#include "Date.h"
 #include "Transaction.h"
 #include "Fine.h"
+#include "FineLedger.h"
+#include "KeywordIndex.h"
+#include "TrigramIndex.h"
+#include "AutocompleteIndex.h"
+#include "BookQuery.h"
+#include "BookCursor.h"
+
+// -----------------------------------------------------------------------------
+// ReturnResult
+// -----------------------------------------------------------------------------
+// What Library::processReturn() hands back: the completed transaction and the
+// fine charged for it, so callers don't have to search for the transaction
+// again to show the return details.
+// -----------------------------------------------------------------------------
+
+struct ReturnResult {
+    Transaction transaction;
+    Fine fine;
+};
+
+// -----------------------------------------------------------------------------
+// FuzzyMatch
+// -----------------------------------------------------------------------------
+// One result of Library::fuzzySearch(): a book and how many edits its title
+// or author is from the query.
+// -----------------------------------------------------------------------------
+
+struct FuzzyMatch {
+    BookRef book;
+    int distance;
+};
+
+// -----------------------------------------------------------------------------
+// Report totals
+// -----------------------------------------------------------------------------
+// Catalog-wide aggregates computed by Library::inventoryTotals() and
+// Library::transactionTotals().
+// -----------------------------------------------------------------------------
+
+struct InventoryTotals {
+    int titles = 0;
+    long totalCopies = 0;
+    long availableCopies = 0;
+};
+
+struct TransactionTotals {
+    int active = 0;
+    int returned = 0;
+    int late = 0;
+    long daysLate = 0;  // sum of calculateDaysLate() over all returns
+};
+
+// -----------------------------------------------------------------------------
+// LibraryStats
+// -----------------------------------------------------------------------------
+// Running totals behind the librarian report. Library updates them in every
+// operation that changes them, so reading them is O(1); loadFromCSV
+// recomputes them once after loading.
+// -----------------------------------------------------------------------------
+
+struct LibraryStats {
+    int titles = 0;
+    long totalCopies = 0;
+    long availableCopies = 0;
+
+    int activeLoans = 0;
+    int returned = 0;       // returned on time
+    int lateReturns = 0;
+    long daysLate = 0;      // sum over all late returns
+
+    int fineCount = 0;
+    Money fineTotal;        // exact, in cents
+};
 
 // -----------------------------------------------------------------------------
 // Library (Singleton)
@@ -25,13 +103,98 @@ private:
     // -----------------------
     // Internal Data Storage
     // -----------------------
-    std::vector<Book> books;
+    BookCatalog books;  // columnar slot map: O(1) insert/remove, stable handles
     std::vector<Transaction> transactions;
-    std::vector<Fine> fines;
+    FineLedger fines;   // by user and transaction
+
+    // bookId -> handle in `books`, kept in sync by addBook, removeBook
+    // and loadFromCSV so lookups never scan the catalog
+    std::unordered_map<int, BookHandle> bookIndex;
+
+    // Later records that repeat an indexed ID (older books.csv files).
+    // They stay in the catalog unindexed, and removeBook removes them
+    // together with the indexed record, as the old remove_if did.
+    std::unordered_map<int, std::vector<BookHandle>> repeatedIds;
+
+    // packed ISBN -> handle. Unique: addBook refuses a second book with
+    // the same ISBN. Books without a valid ISBN (empty, or legacy values
+    // in the CSV) are not in it, nor are CSV rows that repeat an earlier
+    // row's ISBN: those are loaded and saved, but stay unindexed.
+    std::unordered_map<Isbn::Key, BookHandle> isbnIndex;
+
+    // Catalog positions of the given book IDs, ascending (catalog order)
+    std::vector<std::size_t> catalogPositions(const std::vector<int>& ids) const;
+
+    // transactionId -> position in `transactions`. IDs come from
+    // nextTransactionId so they are dense: the vector is indexed by ID
+    // directly (-1 = no such transaction). IDs far beyond the table
+    // (hand-edited CSV) go to the sparse map instead of growing it.
+    std::vector<long> transactionSlots;
+    std::unordered_map<int, std::size_t> sparseTransactionSlots;
+
+    void indexTransaction(int transactionId, std::size_t pos);
+
+    // userId -> IDs of that user's active (not yet returned) transactions,
+    // in checkout order. Updated by checkoutBook and processReturn.
+    std::unordered_map<int, std::vector<int>> activeLoans;
+
+    void dropActiveLoan(int userId, int transactionId);
+
+    // (due day, transactionId) of every active loan, ordered by due date,
+    // so overdue / due-soon queries are one lower_bound plus a walk over
+    // the matches. Updated by checkoutBook, processReturn and loadFromCSV.
+    std::set<std::pair<std::int32_t, int>> dueIndex;
+
+    std::vector<Transaction*> loansDueIn(std::int32_t firstDay, std::int32_t lastDay);
+
+    // Word index over titles and authors, maintained by addBook,
+    // removeBook and loadFromCSV
+    KeywordIndex keywordIndex;
+
+    // Trigram index over title, author and ISBN for substring search
+    TrigramIndex trigramIndex;
+
+    // Title/author prefixes for type-ahead, ranked by circulation
+    AutocompleteIndex autocomplete;
+
+    // After loadSnapshot the three search indexes above start empty and
+    // pending: each is built from the catalog (autocomplete also from the
+    // loans) the first time a search needs it, so startup doesn't pay for
+    // indexes a session never uses. Mutations skip a pending index.
+    bool keywordIndexPending = false;
+    bool trigramIndexPending = false;
+    bool autocompletePending = false;
+
+    // Catalog positions of the books a CSV load would index (the first
+    // record of a repeated ID), ascending
+    std::vector<std::size_t> indexedPositions() const;
+
+    void ensureKeywordIndex();
+    void ensureTrigramIndex();
+    void ensureAutocomplete();
+
+    // Query planner: candidate book IDs (ascending, a superset of the
+    // matches) from the most selective index, or false if only a full
+    // scan can answer the query
+    bool planCandidates(const BookQuery& query, std::vector<int>& ids) const;
 
     int nextBookId = 1;
     int nextTransactionId = 1;
 
+    // Report totals, kept current by every mutating operation
+    LibraryStats statsCache;
+
+    // Rebuilds statsCache with full scans (after a bulk load)
+    void recomputeStats();
+
+    // loadFromCSV steps for books.csv and fines.csv (mapped file text)
+    void loadBooks(std::string_view text, const std::string& file);
+    void loadFines(std::string_view text, const std::string& file);
+
+    // Appends a loaded transaction (CSV or snapshot) and indexes it:
+    // transaction slot, active loans, due dates and autocomplete rank
+    void appendLoadedTransaction(const Transaction& t);
+
     // Private constructor (Singleton)
     Library();
 
@@ -47,33 +210,98 @@ public:
     // Book Management
     // -----------------------
 
-    // Find book by ID (returns nullptr if not found)
-    Book* findBookById(int id);
+    // Find book by ID in O(1) (returns a null BookRef if not found).
+    // The view is only valid until the catalog is next modified.
+    BookRef findBookById(int id);
+
+    // Find book by ISBN in O(1): ISBN-10 or ISBN-13, hyphens allowed.
+    // Null BookRef if not found or not a valid ISBN.
+    BookRef findBookByIsbn(const std::string& isbn);
+
+    // Stable handle for a book ID (null handle if not found)
+    BookHandle findBookHandle(int id) const;
+
+    // Resolve a handle to the book it names (null BookRef if removed)
+    BookRef resolve(BookHandle handle);
 
-    // Add book — returns the created book ID
+    // Add book — returns the created book ID.
+    // A non-empty ISBN must be valid and not already in the catalog
+    // (throws invalid_argument); it is stored in its 13-digit form.
     int addBook(const std::string& title,
                 const std::string& author,
                 const std::string& isbn,
                 int copies);
 
-    // Remove book — returns true if removed
+    // Remove book in O(1) — returns true if removed. If a loaded file
+    // repeated the ID, those records are removed with it.
+    // The last book in catalog order takes the removed book's place.
     bool removeBook(int id);
 
-    // Get reference to all books
-    std::vector<Book>& getAllBooks();
+    // Change a book's total copies (same validation as Book::setTotalCopies)
+    // and keep the report totals in step. False if the book doesn't exist.
+    bool setBookTotalCopies(int id, int total);
+
+    // Get reference to all books (iterable like a vector).
+    // Change copy counts through Library, not through the BookRefs, or
+    // stats() will drift.
+    BookCatalog& getAllBooks();
 
     // -----------------------
-    // Book Search (Generic)
+    // Book Search
     // -----------------------
+
+    // Books whose title/author contain every word of the query
+    // (case-insensitive, whole words), in ascending ID order.
+    // Served from the keyword index without scanning the catalog.
+    std::vector<BookRef> searchByKeywords(const std::string& query);
+
+    // Every book whose author is exactly `author`, in ascending ID order.
+    // One lookup in the catalog's author dictionary, no scan.
+    std::vector<BookRef> booksByAuthor(const std::string& author);
+
+    // Books whose title, author or ISBN contain `text` (same results and
+    // order as scanning with Book::matches). Queries of 3+ characters
+    // only verify the trigram index's candidates instead of every book.
+    std::vector<BookRef> searchSubstring(const std::string& text);
+
+    // Books whose title or author contains the query within maxDistance
+    // edits (case-insensitive), closest first. The trigram index prunes
+    // the catalog before the bit-parallel edit-distance check runs.
+    std::vector<FuzzyMatch> fuzzySearch(const std::string& query,
+                                        int maxDistance);
+
+    // Up to k titles/authors starting with prefix (case-insensitive),
+    // most borrowed first
+    std::vector<std::string> suggest(const std::string& prefix,
+                                     std::size_t k = 5);
+
+    // Lazy, paginated version of searchSubstring(): matches are verified
+    // page by page, from the trigram candidates when there are at most
+    // BookCursor::MAX_CANDIDATES of them, otherwise by the lazy scan
+    BookCursor searchSubstringCursor(const std::string& text);
+
+    // Books matching a composable query, in catalog order. The planner
+    // narrows the catalog with the most selective index it can use
+    // (trigrams, keywords, ID index) and only verifies those candidates;
+    // it falls back to a filtered scan when no index applies.
+    std::vector<BookRef> runQuery(const BookQuery& query);
+
+    // Generic fallback: scans every book with an arbitrary predicate
     template <typename Predicate>
-    std::vector<Book*> searchBooks(Predicate pred) {
-        std::vector<Book*> results;
-        for (auto& b : books) {
-            if (pred(b)) results.push_back(&b);
+    std::vector<BookRef> searchBooks(Predicate pred) {
+        std::vector<BookRef> results;
+        for (BookRef b : books) {
+            if (pred(b)) results.push_back(b);
         }
         return results;
     }
 
+    // Lazy, paginated version of searchBooks()
+    template <typename Predicate>
+    BookCursor searchBooksCursor(Predicate pred) {
+        return BookCursor(*this, pred);
+    }
+
     // -----------------------
     // Checkout / Return
     // -----------------------
@@ -84,30 +312,109 @@ public:
                      const std::string& checkoutDate,
                      const std::string& dueDate);
 
+    // Find transaction by ID in O(1) (returns nullptr if not found)
+    Transaction* findTransactionById(int transactionId);
+
+    // Active loans of one user, in checkout order. Cost is proportional to
+    // that user's loans, not to the whole transaction history. The pointers
+    // are only valid until the next checkout.
+    std::vector<Transaction*> getActiveLoans(int userId);
+
+    // Number of active loans held by a user
+    int countActiveLoans(int userId) const;
+
+    // Active loans due before `asOf` (overdue on that day), most overdue
+    // first. O(log n + k) for k results.
+    std::vector<Transaction*> overdueAsOf(Date asOf);
+
+    // Active loans due from `from` through `from + days`, soonest first
+    std::vector<Transaction*> dueWithin(Date from, int days);
+
+    // Number of active loans due before `asOf`. Counted by walking the
+    // due index, so O(log n + k) for k overdue loans, not O(1).
+    int countOverdue(Date asOf) const;
+
     // Process return and compute any fine
-    Fine processReturn(int transactionId,
-                       const std::string& returnDate);
+    ReturnResult processReturn(int transactionId,
+                               const std::string& returnDate);
 
     // -----------------------
     // Date Utility
     // -----------------------
+    // Days from d1 to d2 ("YYYY-MM-DD"), negative if d2 is earlier;
+    // 0 if either date can't be parsed
     static int daysBetween(const std::string& d1,
                            const std::string& d2);
 
     // -----------------------
     // File Persistence (CSV)
     // -----------------------
+    // A missing fines file is not an error (data saved before fines were
+    // persisted); the ledger's balances are rebuilt while it is read.
+    // transactions.csv is parsed in `threads` chunks on the shared pool
+    // while the books load (0 = one chunk per core, 1 = all sequential).
     void loadFromCSV(const std::string& booksFile = "books.csv",
-                     const std::string& transFile = "transactions.csv");
+                     const std::string& transFile = "transactions.csv",
+                     const std::string& finesFile = "fines.csv",
+                     std::size_t threads = 0);
 
     void saveToCSV(const std::string& booksFile = "books.csv",
-                   const std::string& transFile = "transactions.csv");
+                   const std::string& transFile = "transactions.csv",
+                   const std::string& finesFile = "fines.csv");
+
+    // -----------------------
+    // File Persistence (Snapshot)
+    // -----------------------
+    // library.snap is a binary copy of the three CSV files (Snapshot.h)
+    // that loads without parsing any text. loadSnapshot only fills an
+    // empty Library, and only from an intact snapshot saved with the CSV
+    // files as they are now; otherwise it changes nothing and returns false.
+    bool loadSnapshot(const std::string& booksFile = "books.csv",
+                      const std::string& transFile = "transactions.csv",
+                      const std::string& finesFile = "fines.csv",
+                      const std::string& snapFile = "library.snap");
+
+    // Snapshot of the current data, stamped with the CSV files as they
+    // are now (so save the CSV first). False if it can't be written.
+    bool saveSnapshot(const std::string& booksFile = "books.csv",
+                      const std::string& transFile = "transactions.csv",
+                      const std::string& finesFile = "fines.csv",
+                      const std::string& snapFile = "library.snap") const;
+
+    // Startup: the snapshot when it is current, otherwise the CSV files
+    // (then a fresh snapshot is written for the next start)
+    void load(const std::string& booksFile = "books.csv",
+              const std::string& transFile = "transactions.csv",
+              const std::string& finesFile = "fines.csv",
+              const std::string& snapFile = "library.snap");
+
+    // The CSV files, then a snapshot matching them
+    void save(const std::string& booksFile = "books.csv",
+              const std::string& transFile = "transactions.csv",
+              const std::string& finesFile = "fines.csv",
+              const std::string& snapFile = "library.snap");
 
     // -----------------------
     // Logs
     // -----------------------
     std::vector<Transaction>& getTransactions();
-    std::vector<Fine>& getFines();
+    const FineLedger& getFines() const;
+
+    // Unpaid fines of one user, O(1)
+    Money outstandingFines(int userId) const;
+
+    // Marks a transaction's fine paid; false if it has none or it was paid
+    bool payFine(int transactionId);
+
+    // -----------------------
+    // Reports
+    // -----------------------
+    // Running totals: O(1), always current
+    const LibraryStats& stats() const { return statsCache; }
+
+    // Full recomputation: one pass over the books / transactions
+    InventoryTotals inventoryTotals() const;
+    TransactionTotals transactionTotals() const;
 };
 
 #endif // LIBRARY_H
@@ -0,0 +1,49 @@
+/**
+ MappedFile.h
+ The 'MappedFile' class maps a whole file read-only into memory (mmap on
+ POSIX, a file mapping view on Windows). The loader then tokenizes the
+ file's bytes in place with string_views: nothing is copied into
+ per-line strings, and the OS pages the file in as it is read.
+
+ The mapping lives as long as the MappedFile, so views into text() must
+ not outlive it. Empty files open fine and have an empty text().
+ **/
+
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+class MappedFile {
+private:
+    const char* bytes = nullptr;
+    std::size_t length = 0;
+    bool opened = false;
+
+    void unmap();
+
+public:
+    MappedFile() = default;
+    explicit MappedFile(const std::string& path) { open(path); }
+    ~MappedFile() { unmap(); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    // Maps the file, replacing any current mapping. False if it can't be
+    // opened (missing, unreadable).
+    bool open(const std::string& path);
+
+    bool isOpen() const { return opened; }
+
+    const char* data() const { return bytes; }
+    std::size_t size() const { return length; }
+    std::string_view text() const { return std::string_view(bytes, length); }
+};
+
+#endif
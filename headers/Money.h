@@ -0,0 +1,75 @@
+/**
+ Money.h
+ The 'Money' class is the library's currency type: a whole number of
+ cents in a 64-bit integer. Adding up thousands of fines stays exact
+ (a double drifts as soon as amounts like $0.10 are summed), and the
+ arithmetic is constexpr so rates such as Fine::PER_DAY are compile-time
+ constants.
+
+ Example:
+   Money rate = Money::fromCents(50);   // $0.50
+   Money fine = rate * 18;              // $9.00
+   fine.toString();                     // "9.00"
+ **/
+
+#ifndef MONEY_H
+#define MONEY_H
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+class Money {
+    std::int64_t amountCents;
+
+    constexpr explicit Money(std::int64_t c) : amountCents(c) {}
+
+public:
+    // ==================== CONSTRUCTORS ====================
+
+    constexpr Money() : amountCents(0) {}
+
+    static constexpr Money fromCents(std::int64_t c) { return Money(c); }
+
+    // Rounds to the nearest cent (half away from zero)
+    static Money fromDollars(double dollars);
+
+    /**
+     * parse - Reads a plain decimal amount: "12", "12.5", "12.34", "-0.50".
+     * At most two decimals and no currency sign or separators.
+     * Returns false, leaving `out` alone, for anything else.
+     */
+    static bool parse(std::string_view s, Money& out);
+
+    // ==================== ACCESSORS ====================
+
+    constexpr std::int64_t cents() const { return amountCents; }
+
+    double toDollars() const { return static_cast<double>(amountCents) / 100.0; }
+
+    // Two decimals, no currency sign ("9.00", "-0.50")
+    std::string toString() const;
+
+    // ==================== ARITHMETIC ====================
+
+    constexpr Money operator+(Money o) const { return Money(amountCents + o.amountCents); }
+    constexpr Money operator-(Money o) const { return Money(amountCents - o.amountCents); }
+    constexpr Money operator-() const { return Money(-amountCents); }
+    constexpr Money operator*(std::int64_t n) const { return Money(amountCents * n); }
+
+    constexpr Money& operator+=(Money o) { amountCents += o.amountCents; return *this; }
+    constexpr Money& operator-=(Money o) { amountCents -= o.amountCents; return *this; }
+
+    constexpr bool operator==(Money o) const { return amountCents == o.amountCents; }
+    constexpr bool operator!=(Money o) const { return amountCents != o.amountCents; }
+    constexpr bool operator<(Money o) const { return amountCents < o.amountCents; }
+    constexpr bool operator<=(Money o) const { return amountCents <= o.amountCents; }
+    constexpr bool operator>(Money o) const { return amountCents > o.amountCents; }
+    constexpr bool operator>=(Money o) const { return amountCents >= o.amountCents; }
+};
+
+// Writes toString()
+std::ostream& operator<<(std::ostream& os, Money m);
+
+#endif
@@ -0,0 +1,25 @@
+/**
+ SimdScan.h
+ The 'SimdScan' class picks the instruction set for CsvReader's
+ hand-vectorized record classifier. The kernel is picked once, at first use, from what the CPU supports: AVX2, then SSE2,
+ then a portable scalar loop (non-x86 builds).
+
+ Substring search doesn't use it: std::string_view::find measured faster
+ than a first/last-character SSE2/AVX2 filter on catalog text.
+ **/
+
+#ifndef SIMDSCAN_H
+#define SIMDSCAN_H
+
+class SimdScan {
+public:
+    enum class Kernel { Scalar, SSE2, AVX2 };
+
+    // Kernel chosen for this CPU
+    static Kernel activeKernel();
+
+    // Printable kernel name ("AVX2", "SSE2" or "Scalar")
+    static const char* kernelName();
+};
+
+#endif
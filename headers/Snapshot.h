@@ -0,0 +1,175 @@
+/**
+ Snapshot.h
+ The 'Snapshot' class defines library.snap, a binary copy of everything
+ saveToCSV writes (books, transactions and fines) that loads without any
+ text parsing. The file is laid out so it can be mapped (MappedFile) and
+ its records read in place:
+
+   Header             magic, version, byte order, counts, checksum
+   BookRecord[]       fixed size; title/author/ISBN are offsets into
+                      the string heap
+   TransactionRecord[] fixed size, dates as day numbers
+   FineRecord[]       fixed size, amounts in cents
+   string heap        title, author and ISBN of each book, back to back
+
+ Every section starts on an 8-byte boundary, so the record arrays are
+ used straight from the mapping. open() checks the magic, version, byte
+ order, sizes, every string range and a 64-bit checksum of everything
+ after the header before handing out views; a snapshot from another
+ version or a damaged file is rejected and the caller falls back to CSV.
+
+ The header also keeps a stamp (size and modification time) of the CSV
+ files the snapshot was saved with. If those files have changed since
+ (edited by hand, restored from a backup), the snapshot is stale and the
+ CSV wins.
+
+ Example:
+   MappedFile file("library.snap");
+   Snapshot::View view;
+   std::string why;
+   if (file.isOpen() && Snapshot::open(file.text(), view, why))
+       for (std::uint64_t i = 0; i < view.header->bookCount; ++i)
+           view.title(view.books[i]);   // string_view into the mapping
+ **/
+
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+class Snapshot {
+public:
+    // Bumped whenever a record layout changes; older files are ignored
+    static constexpr std::uint32_t VERSION = 1;
+    static constexpr char MAGIC[8] = {'L', 'I', 'B', 'S', 'N', 'A', 'P', '\0'};
+
+    // Written in the host's byte order; a file from a machine with the
+    // other order reads back as 0x04030201 and is rejected
+    static constexpr std::uint32_t ENDIAN_MARK = 0x01020304;
+
+    // ==================== ON-DISK RECORDS ====================
+
+    struct Header {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t byteOrder;
+        std::uint64_t fileSize;
+        std::uint64_t checksum;       // of every byte after the header
+        std::uint64_t sourceStamp;    // sourceStamp() of the CSV files
+        std::int32_t nextBookId;
+        std::int32_t nextTransactionId;
+        std::uint64_t bookCount;
+        std::uint64_t transactionCount;
+        std::uint64_t fineCount;
+        std::uint64_t stringBytes;
+    };
+
+    // Title, author and ISBN are stored back to back at textOffset
+    struct BookRecord {
+        std::int32_t bookId;
+        std::int32_t totalCopies;
+        std::int32_t availableCopies;
+        std::uint32_t titleLength;
+        std::uint32_t authorLength;
+        std::uint32_t isbnLength;
+        std::uint64_t textOffset;
+    };
+
+    struct TransactionRecord {
+        std::int32_t transactionId;
+        std::int32_t userId;
+        std::int32_t bookId;
+        std::int32_t checkoutDay;     // Transaction::NO_DATE if missing
+        std::int32_t dueDay;
+        std::int32_t returnDay;
+        std::uint8_t status;          // Transaction::Status
+        std::uint8_t padding[3];
+    };
+
+    struct FineRecord {
+        std::int64_t cents;
+        std::int32_t transactionId;
+        std::int32_t userId;
+        std::uint8_t paid;
+        std::uint8_t padding[7];
+    };
+
+    static_assert(std::is_trivially_copyable<Header>::value
+                  && std::is_trivially_copyable<BookRecord>::value
+                  && std::is_trivially_copyable<TransactionRecord>::value
+                  && std::is_trivially_copyable<FineRecord>::value,
+                  "snapshot records are copied as raw bytes");
+    static_assert(sizeof(Header) == 80 && sizeof(BookRecord) == 32
+                  && sizeof(TransactionRecord) == 28 && sizeof(FineRecord) == 24,
+                  "snapshot record layout changed: bump VERSION");
+
+    // ==================== READING ====================
+
+    // Sections of a validated snapshot, pointing into its bytes
+    struct View {
+        const Header* header = nullptr;
+        const BookRecord* books = nullptr;
+        const TransactionRecord* transactions = nullptr;
+        const FineRecord* fines = nullptr;
+        std::string_view strings;
+
+        std::string_view title(const BookRecord& b) const {
+            return strings.substr(b.textOffset, b.titleLength);
+        }
+        std::string_view author(const BookRecord& b) const {
+            return strings.substr(b.textOffset + b.titleLength, b.authorLength);
+        }
+        std::string_view isbn(const BookRecord& b) const {
+            return strings.substr(b.textOffset + b.titleLength + b.authorLength, b.isbnLength);
+        }
+    };
+
+    /**
+     * open - Validates a whole snapshot (usually a MappedFile's text) and
+     * fills `view`. False with the reason in `why` if the bytes are not a
+     * complete, intact snapshot of this VERSION. The bytes must stay
+     * alive, and 8-byte aligned (a mapping is), while the view is used.
+     */
+    static bool open(std::string_view bytes, View& view, std::string& why);
+
+    // ==================== WRITING ====================
+
+    // Records gathered by the caller; the header is filled in by write()
+    struct Contents {
+        std::int32_t nextBookId = 1;
+        std::int32_t nextTransactionId = 1;
+        std::uint64_t sourceStamp = 0;
+        std::vector<BookRecord> books;
+        std::vector<TransactionRecord> transactions;
+        std::vector<FineRecord> fines;
+        std::string strings;
+
+        // Appends a book's three strings to the heap and its record
+        void addBook(std::int32_t id, std::string_view title, std::string_view author,
+                     std::string_view isbn, std::int32_t total, std::int32_t available);
+    };
+
+    /**
+     * write - Saves the snapshot to a temporary file beside `path` and
+     * renames it into place, so a crash mid-write never leaves a torn
+     * snapshot behind. False if the file can't be written.
+     */
+    static bool write(const std::string& path, const Contents& contents);
+
+    // ==================== HELPERS ====================
+
+    // 64-bit checksum of a byte range (four independent lanes, so it
+    // runs at several GB/s; detects damage, not tampering)
+    static std::uint64_t checksum(const char* data, std::size_t size);
+
+    // Hash of the size and modification time of each file (missing files
+    // count too), to tell whether a snapshot still matches its CSV
+    static std::uint64_t sourceStamp(const std::vector<std::string>& files);
+};
+
+#endif
@@ -0,0 +1,103 @@
+/**
+ ThreadPool.h
+ The 'ThreadPool' class runs tasks on a fixed set of worker threads.
+ Library::loadFromCSV uses it to parse CSV chunks and build the search
+ indexes concurrently; mapChunks() results are merged in chunk order, so
+ the output is identical to a sequential pass.
+
+ NOTE: tasks must not wait on other tasks of the same pool (no nesting).
+ **/
+
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <utility>
+#include <vector>
+
+class ThreadPool {
+private:
+    std::vector<std::thread> workers;
+    std::queue<std::function<void()>> tasks;
+    std::mutex lock;
+    std::condition_variable wake;
+    bool stopping = false;
+
+    void workerLoop();
+
+public:
+    // Chunks smaller than this aren't worth a thread hand-off
+    static constexpr std::size_t MIN_CHUNK = 4096;
+
+    // Starts `threads` workers (at least one)
+    explicit ThreadPool(std::size_t threads);
+
+    // Finishes queued tasks, then joins the workers
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    std::size_t size() const { return workers.size(); }
+
+    // Process-wide pool with one worker per hardware thread
+    static ThreadPool& shared();
+
+    /**
+     * splitRange - Cuts [0, n) into at most `parts` contiguous [begin, end)
+     * ranges of at least MIN_CHUNK items (one range for small inputs)
+     */
+    static std::vector<std::pair<std::size_t, std::size_t>>
+    splitRange(std::size_t n, std::size_t parts);
+
+    // Queues a task; the future yields its result (or rethrows its exception)
+    template <typename F>
+    auto submit(F f) -> std::future<decltype(f())> {
+        using R = decltype(f());
+        auto task = std::make_shared<std::packaged_task<R()>>(std::move(f));
+        std::future<R> result = task->get_future();
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            tasks.emplace([task] { (*task)(); });
+        }
+        wake.notify_one();
+        return result;
+    }
+
+    /**
+     * mapChunks - Calls fn(begin, end) for each splitRange() chunk of [0, n)
+     * and returns the results in chunk order. A single chunk runs inline on
+     * the calling thread. parts == 0 means one chunk per worker.
+     */
+    template <typename F>
+    auto mapChunks(std::size_t n, std::size_t parts, F fn)
+        -> std::vector<decltype(fn(std::size_t{}, std::size_t{}))>
+    {
+        using R = decltype(fn(std::size_t{}, std::size_t{}));
+
+        auto ranges = splitRange(n, parts == 0 ? size() : parts);
+        std::vector<R> results;
+        results.reserve(ranges.size());
+
+        if (ranges.size() == 1) {
+            results.push_back(fn(ranges[0].first, ranges[0].second));
+            return results;
+        }
+
+        std::vector<std::future<R>> pending;
+        for (const auto& r : ranges)
+            pending.push_back(submit([fn, r] { return fn(r.first, r.second); }));
+        for (auto& f : pending)
+            results.push_back(f.get());
+        return results;
+    }
+};
+
+#endif
@@ -10,31 +10,53 @@
 #ifndef TRANSACTION_H
 #define TRANSACTION_H
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <stdexcept>
 
 class Transaction {
+public:
+    // Status is one byte; getStatus() still returns the text form
+    enum class Status : std::uint8_t {
+        Active,        // "Active"
+        Returned,      // "Returned"
+        ReturnedLate   // "Returned-Late"
+    };
+
+    // Day number of a missing date (e.g. no return date yet)
+    static constexpr std::int32_t NO_DATE = INT32_MIN;
+
 private:
-    int transactionId;
-    int userId;
-    int bookId;
+    // Fixed-size record: three IDs, three day numbers, one status byte.
+    // Dates are parsed once, when they are set; every later comparison
+    // or lateness check is integer arithmetic.
+    std::int32_t transactionId;
+    std::int32_t userId;
+    std::int32_t bookId;
 
-    std::string checkoutDate;
-    std::string dueDate;
-    std::string returnDate;
+    std::int32_t checkoutDay;  // Date::dayNumber(): days since 1970-01-01
+    std::int32_t dueDay;
+    std::int32_t returnDay;    // NO_DATE while active
 
-    std::string status; // "Active", "Returned", "Returned-Late"
+    Status status;
 
     /**
-     * parseDateToComponents - Breaks a date string into year, month, day
-     * @param dateStr  - Date string
-     * @return true if parsing successful, false otherwise
+     * parseDay - Converts "YYYY-MM-DD" to a day number
+     * Month and day may have one or two digits ("2025-12-5").
+     * An empty string gives NO_DATE; anything that is not a real calendar
+     * date throws invalid_argument naming `field`.
      */
-    static bool parseDateToComponents(const std::string& dateStr,
-                                      int& year, int& month, int& day);
-    static int dateToDays(int year, int month, int day);
+    static std::int32_t parseDay(const std::string& dateStr, const char* field);
+
+    // Day number back to "YYYY-MM-DD" ("" for NO_DATE)
+    static std::string formatDay(std::int32_t day);
 
 public:
+    // Status text -> enum; ok is false for unknown text (gives Active)
+    static Status parseStatus(std::string_view s, bool& ok);
+
     // ==================== CONSTRUCTORS ====================
      //Default Constructor
     Transaction(); // Default Constructor
@@ -62,21 +84,38 @@ public:
      * @param due      - Due date
      * @param returned - Return date
      * @param stat     - Status ("Active", "Returned", "Returned-Late")
+     * Throws invalid_argument if a non-empty date is not a valid date.
      */
     Transaction(int tid, int uid, int bid,
                 std::string checkout, std::string due,
                 std::string returned, std::string stat);
 
+    /**
+     * Day-number Constructor - For the file loader, which parses the
+     * dates itself (NO_DATE for a missing one). Same ID validation.
+     */
+    Transaction(int tid, int uid, int bid,
+                std::int32_t checkout, std::int32_t due,
+                std::int32_t returned, Status stat);
+
     // ==================== GETTERS ====================
 
     int getTransactionId() const { return transactionId; }
     int getUserId() const { return userId; }
     int getBookId() const { return bookId; }
 
-    std::string getCheckoutDate() const { return checkoutDate; }
-    std::string getDueDate() const { return dueDate; }
-    std::string getReturnDate() const { return returnDate; }
-    std::string getStatus() const { return status; }
+    // Dates as "YYYY-MM-DD" text, for display and CSV
+    std::string getCheckoutDate() const { return formatDay(checkoutDay); }
+    std::string getDueDate() const { return formatDay(dueDay); }
+    std::string getReturnDate() const { return formatDay(returnDay); }
+    std::string getStatus() const;
+
+    // Dates as day numbers (NO_DATE if missing)
+    std::int32_t getCheckoutDay() const { return checkoutDay; }
+    std::int32_t getDueDay() const { return dueDay; }
+    std::int32_t getReturnDay() const { return returnDay; }
+
+    Status getStatusCode() const { return status; }
     // ==================== SETTERS ====================
 
     void setTransactionId(int tid);
@@ -95,22 +134,27 @@ public:
      * Edge Cases Handled:
      * 1. Return date empty -> returns 0 (still active, no late fee yet)
      * 2. Return date <= due date -> returns 0 (on time)
-     * 3. Invalid date format -> returns 0 with warning
+     * 3. Missing due date -> returns 0
      * return Number of days late (0 if on time or still active)
      */
     int calculateDaysLate() const;
 
+    // Batch version: out[i] = records[i].calculateDaysLate() for i < n,
+    // computed block by block with the vectorizable Date::daysLate
+    static void calculateDaysLate(const Transaction* records, std::size_t n,
+                                  std::int32_t* out);
+
     /*
      * isActive - Checks if the transaction is still active (book not returned)
      * return true if status is "Active", false otherwise
      */
-    bool isActive() const { return status == "Active"; }
+    bool isActive() const { return status == Status::Active; }
 
     /*
      * isLate - Checks if the book was returned late
      * return true if status is "Returned-Late", false otherwise
      */
-    bool isLate() const { return status == "Returned-Late"; }
+    bool isLate() const { return status == Status::ReturnedLate; }
 
     /**
      * completeReturn - Marks the transaction as complete
@@ -119,7 +163,7 @@ public:
      * @param returnDateStr - The date the book was returned
 
     Edge Cases:
-      -Empty return date -> throws invalid_argument
+      -Empty or invalid return date -> throws invalid_argument
      -Transaction already completed -> throws runtime_error
      */
     void completeReturn(const std::string& returnDateStr);
@@ -0,0 +1,65 @@
+/**
+ TrigramIndex.h
+ The 'TrigramIndex' class indexes every 3-character window ("trigram") of a
+ book's title, author and ISBN. Any substring of 3+ characters can only occur
+ in a book that contains all of the substring's trigrams, so intersecting
+ their posting lists yields a small candidate set that is then verified with
+ an exact match. Trigrams are case-folded: the candidate set is a superset
+ of both case-sensitive and case-insensitive matches.
+ **/
+
+#ifndef TRIGRAMINDEX_H
+#define TRIGRAMINDEX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+class TrigramIndex {
+private:
+    // packed trigram -> sorted, duplicate-free book IDs
+    std::unordered_map<std::uint32_t, std::vector<int>> postings;
+
+    // Distinct trigrams of one or more fields (each field scanned separately)
+    static std::vector<std::uint32_t> trigramsOf(std::string_view a,
+                                                 std::string_view b = {},
+                                                 std::string_view c = {});
+
+public:
+    // Shortest query the index can filter; shorter ones need a full scan
+    static constexpr std::size_t MIN_QUERY_LENGTH = 3;
+
+    // Adds a book's title, author and ISBN trigrams to the index
+    void addBook(int bookId, std::string_view title,
+                 std::string_view author, std::string_view isbn);
+
+    // Removes a book; fields must be the values it was added with
+    void removeBook(int bookId, std::string_view title,
+                    std::string_view author, std::string_view isbn);
+
+    /**
+     * candidates - IDs (ascending) of books that MAY contain the query
+     * @return false if the query is too short to filter, or if even its
+     *         rarest trigram is in more than maxCandidates books (caller
+     *         must scan); nothing is copied in either case
+     */
+    bool candidates(const std::string& query, std::vector<int>& out,
+                    std::size_t maxCandidates = SIZE_MAX) const;
+
+    /**
+     * fuzzyCandidates - IDs (ascending) of books that MAY contain the query
+     * within maxEdits edits. Each edit destroys at most 3 of the query's
+     * trigrams, so a match must still share (distinct trigrams - 3*maxEdits).
+     * @return false if that bound is <= 0 (caller must scan)
+     */
+    bool fuzzyCandidates(const std::string& query, int maxEdits,
+                         std::vector<int>& out) const;
+
+    // Drops every posting list
+    void clear();
+};
+
+#endif
@@ -126,10 +126,15 @@ void Admin::manageInventory() {
         return;
     }
 
-    // Display all books
+    // Display all books, one line each, straight from the catalog columns
     std::cout << "\n=== Current Inventory ===\n";
     for (const auto& b : books) {
-        b.display();
+        std::cout << b.getBookId() << ": "
+                  << b.getTitle() << " | "
+                  << b.getAuthor() << " | ISBN: "
+                  << b.getIsbn() << " | copies: "
+                  << b.getAvailableCopies() << "/"
+                  << b.getTotalCopies() << "\n";
     }
 
     // Edit a book’s quantity
@@ -139,7 +144,7 @@ void Admin::manageInventory() {
 
     if (id == 0) return;
 
-    Book* b = Library::instance().findBookById(id);
+    BookRef b = Library::instance().findBookById(id);
 
     if (!b) {
         std::cout << "Book not found.\n";
@@ -151,12 +156,8 @@ void Admin::manageInventory() {
     std::cin >> newTotal;
 
     try {
-        b->setTotalCopies(newTotal);
-
-        // Adjust availableCopies if needed
-        if (b->getAvailableCopies() > newTotal) {
-            b->setAvailableCopies(newTotal);
-        }
+        // Through Library so the report totals follow the edit
+        Library::instance().setBookTotalCopies(id, newTotal);
 
         std::cout << "Inventory updated.\n";
     }
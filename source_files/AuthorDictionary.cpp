@@ -0,0 +1,61 @@
+/*
+ AuthorDictionary.cpp
+ Implementation file for the AuthorDictionary class (interned author names
+ with per-author posting lists).
+*/
+
+#include "AuthorDictionary.h"
+#include <algorithm>
+
+// ==================== INTERNING ====================
+
+AuthorDictionary::AuthorId AuthorDictionary::intern(std::string_view name) {
+    AuthorId next = static_cast<AuthorId>(names.size());
+
+    auto inserted = idOf.emplace(std::string(name), next);
+    if (inserted.second) {
+        names.push_back(&inserted.first->first);
+        postings.emplace_back();
+    }
+    return inserted.first->second;
+}
+
+AuthorDictionary::AuthorId AuthorDictionary::find(std::string_view name) const {
+    auto it = idOf.find(std::string(name));
+    return it == idOf.end() ? NO_AUTHOR : it->second;
+}
+
+// ==================== POSTINGS ====================
+
+void AuthorDictionary::addBook(AuthorId id, int bookId) {
+    std::vector<int>& list = postings[id];
+
+    // New books get increasing IDs, so appending is the common case
+    if (list.empty() || list.back() < bookId) {
+        list.push_back(bookId);
+        return;
+    }
+
+    auto pos = std::lower_bound(list.begin(), list.end(), bookId);
+    if (pos == list.end() || *pos != bookId)
+        list.insert(pos, bookId);
+}
+
+void AuthorDictionary::removeBook(AuthorId id, int bookId) {
+    std::vector<int>& list = postings[id];
+
+    auto pos = std::lower_bound(list.begin(), list.end(), bookId);
+    if (pos != list.end() && *pos == bookId)
+        list.erase(pos);
+}
+
+const std::vector<int>& AuthorDictionary::booksBy(AuthorId id) const {
+    static const std::vector<int> none;
+    return id < postings.size() ? postings[id] : none;
+}
+
+void AuthorDictionary::clear() {
+    idOf.clear();
+    names.clear();
+    postings.clear();
+}
@@ -0,0 +1,227 @@
+/*
+ AutocompleteIndex.cpp
+ Implementation file for the AutocompleteIndex class (prefix type-ahead).
+*/
+
+#include "AutocompleteIndex.h"
+#include <algorithm>
+#include <cctype>
+#include <queue>
+
+// Marks "no position" in the segment tree
+static const std::size_t NONE = static_cast<std::size_t>(-1);
+
+// ==================== HELPERS ====================
+
+std::string AutocompleteIndex::lowercase(std::string_view s) {
+    std::string out(s);
+    for (char& c : out)
+        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    return out;
+}
+
+// Rank of the entry at a sorted position (-1 for entries with no books left)
+long AutocompleteIndex::rankAt(std::size_t pos) const {
+    const Entry& e = entries[order[pos]];
+    return e.bookIds.empty() ? -1 : e.rank;
+}
+
+// Picks the better of two positions: higher rank, then alphabetical
+std::size_t AutocompleteIndex::better(std::size_t a, std::size_t b) const {
+    if (a == NONE) return b;
+    if (b == NONE) return a;
+
+    long ra = rankAt(a), rb = rankAt(b);
+    if (ra != rb) return ra > rb ? a : b;
+    return std::min(a, b);
+}
+
+// Best position in order[lo, hi) using the segment tree
+std::size_t AutocompleteIndex::bestIn(std::size_t lo, std::size_t hi) const {
+    std::size_t best = NONE;
+
+    for (std::size_t l = lo + leafBase, r = hi + leafBase; l < r; l >>= 1, r >>= 1) {
+        if (l & 1) best = better(best, tree[l++]);
+        if (r & 1) best = better(best, tree[--r]);
+    }
+    return best;
+}
+
+// Merges pending keys into the sorted order and rebuilds the tree if needed
+void AutocompleteIndex::prepare() {
+    auto byKey = [this](std::size_t a, std::size_t b) {
+        return entries[a].key < entries[b].key;
+    };
+
+    if (sortedCount < order.size()) {
+        auto mid = order.begin() + static_cast<std::ptrdiff_t>(sortedCount);
+        std::sort(mid, order.end(), byKey);
+        std::inplace_merge(order.begin(), mid, order.end(), byKey);
+        sortedCount = order.size();
+
+        posOf.assign(entries.size(), NONE);
+        for (std::size_t pos = 0; pos < order.size(); ++pos)
+            posOf[order[pos]] = pos;
+
+        treeValid = false;
+    }
+
+    if (treeValid) return;
+
+    // Bottom-up segment tree: leaves are positions in 'order'
+    leafBase = order.size();
+    tree.assign(2 * leafBase, NONE);
+    for (std::size_t i = 0; i < leafBase; ++i)
+        tree[leafBase + i] = i;
+    for (std::size_t i = leafBase; i-- > 1;)
+        tree[i] = better(tree[2 * i], tree[2 * i + 1]);
+
+    treeValid = true;
+}
+
+// Re-ranks one entry in O(log n) once the tree is built
+void AutocompleteIndex::refresh(std::size_t entryIdx) {
+    if (!treeValid) return;  // rebuilt from scratch on the next query
+
+    std::size_t i = leafBase + posOf[entryIdx];
+    for (i >>= 1; i >= 1; i >>= 1)
+        tree[i] = better(tree[2 * i], tree[2 * i + 1]);
+}
+
+// ==================== INDEX MAINTENANCE ====================
+
+void AutocompleteIndex::link(int bookId, std::string_view text) {
+    std::string key = lowercase(text);
+    if (key.empty()) return;
+
+    auto found = slotOf.find(key);
+    if (found == slotOf.end()) {
+        // Brand-new key: append now, sort it in on the next query
+        found = slotOf.emplace(key, entries.size()).first;
+        entries.push_back(Entry{key, std::string(text), {}, 0});
+        order.push_back(found->second);
+        treeValid = false;
+    }
+
+    Entry& e = entries[found->second];
+    if (std::find(e.bookIds.begin(), e.bookIds.end(), bookId) != e.bookIds.end())
+        return;
+
+    if (e.bookIds.empty())
+        e.text = text;  // reused slot shows its new spelling
+
+    e.bookIds.push_back(bookId);
+    e.rank += borrowCount[bookId];
+    refresh(found->second);
+}
+
+void AutocompleteIndex::unlink(int bookId, std::string_view text) {
+    auto found = slotOf.find(lowercase(text));
+    if (found == slotOf.end()) return;
+
+    Entry& e = entries[found->second];
+    auto it = std::find(e.bookIds.begin(), e.bookIds.end(), bookId);
+    if (it == e.bookIds.end()) return;
+
+    e.bookIds.erase(it);
+    e.rank -= borrowCount[bookId];
+    refresh(found->second);
+}
+
+void AutocompleteIndex::adjustRank(std::string_view text, long delta) {
+    auto found = slotOf.find(lowercase(text));
+    if (found == slotOf.end()) return;
+
+    entries[found->second].rank += delta;
+    refresh(found->second);
+}
+
+void AutocompleteIndex::addBook(int bookId, std::string_view title,
+                                std::string_view author)
+{
+    link(bookId, title);
+    link(bookId, author);
+}
+
+void AutocompleteIndex::removeBook(int bookId, std::string_view title,
+                                   std::string_view author)
+{
+    unlink(bookId, title);
+    unlink(bookId, author);
+    borrowCount.erase(bookId);
+}
+
+void AutocompleteIndex::recordCheckout(int bookId, std::string_view title,
+                                       std::string_view author)
+{
+    borrowCount[bookId]++;
+
+    adjustRank(title, 1);
+
+    // A book whose title and author fold to the same key counts once
+    if (lowercase(author) != lowercase(title))
+        adjustRank(author, 1);
+}
+
+void AutocompleteIndex::clear() {
+    entries.clear();
+    slotOf.clear();
+    borrowCount.clear();
+    order.clear();
+    posOf.clear();
+    tree.clear();
+    sortedCount = 0;
+    leafBase = 0;
+    treeValid = false;
+}
+
+// ==================== QUERY ====================
+
+std::vector<std::string> AutocompleteIndex::complete(const std::string& prefix,
+                                                     std::size_t k)
+{
+    std::vector<std::string> results;
+    if (k == 0) return results;
+
+    prepare();
+
+    // Every key starting with the prefix sits in one contiguous range
+    std::string key = lowercase(prefix);
+    auto lo = std::lower_bound(order.begin(), order.end(), key,
+        [this](std::size_t idx, const std::string& k2) {
+            return entries[idx].key < k2;
+        });
+    auto hi = std::partition_point(lo, order.end(),
+        [this, &key](std::size_t idx) {
+            return entries[idx].key.compare(0, key.size(), key) == 0;
+        });
+
+    struct Range {
+        std::size_t lo, hi, best;
+    };
+    auto worse = [this](const Range& a, const Range& b) {
+        return better(a.best, b.best) == b.best && a.best != b.best;
+    };
+    std::priority_queue<Range, std::vector<Range>, decltype(worse)> heap(worse);
+
+    auto push = [&](std::size_t l, std::size_t h) {
+        if (l < h) heap.push(Range{l, h, bestIn(l, h)});
+    };
+
+    push(static_cast<std::size_t>(lo - order.begin()),
+         static_cast<std::size_t>(hi - order.begin()));
+
+    // Pop the best range winner, then split its range around it
+    while (!heap.empty() && results.size() < k) {
+        Range r = heap.top();
+        heap.pop();
+
+        if (rankAt(r.best) < 0) break;  // only removed entries remain
+
+        results.push_back(entries[order[r.best]].text);
+        push(r.lo, r.best);
+        push(r.best + 1, r.hi);
+    }
+
+    return results;
+}
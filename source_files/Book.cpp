@@ -7,6 +7,7 @@ Contains all method definitions for book operations.
 */
 
 #include "Book.h"
+#include "CsvReader.h"
 #include <iostream>
 #include <stdexcept> // For exception classes (runtime_error, invalid_argument)
 
@@ -101,6 +102,11 @@ void Book::setIsbn(const std::string& i) {
  *    (Cannot reduce total below what's currently in the library)
  */
 void Book::setTotalCopies(int total) {
+    checkTotalCopies(total, availableCopies);
+    totalCopies = total;
+}
+
+void Book::checkTotalCopies(int total, int availableCopies) {
     // ===== EDGE CASE: Negative total =====
     if (total < 0)
         throw std::invalid_argument("Total copies cannot be negative.");
@@ -111,8 +117,6 @@ void Book::setTotalCopies(int total) {
     if (total < availableCopies)
         throw std::invalid_argument(
             "Total copies cannot be less than currently available copies.");
-
-    totalCopies = total;
 }
 
 /**
@@ -123,6 +127,11 @@ void Book::setTotalCopies(int total) {
  * 2. Available > total -> throws invalid_argument
  */
 void Book::setAvailableCopies(int available) {
+    checkAvailableCopies(available, totalCopies);
+    availableCopies = available;
+}
+
+void Book::checkAvailableCopies(int available, int totalCopies) {
     // ===== EDGE CASE: Negative available =====
     if (available < 0)
         throw std::invalid_argument("Available copies cannot be negative.");
@@ -132,8 +141,6 @@ void Book::setAvailableCopies(int available) {
     if (available > totalCopies)
         throw std::invalid_argument(
             "Available copies cannot exceed total copies.");
-
-    availableCopies = available;
 }
 
 // ==================== CORE FUNCTIONALITY ====================
@@ -157,16 +164,20 @@ void Book::setAvailableCopies(int available) {
  *   book.checkout();  // THROWS runtime_error!
  */
 void Book::checkout() {
-    // ===== EDGE CASE: No copies available =====
     // Check BEFORE decrementing to prevent going negative
-    if (availableCopies <= 0)
-        throw std::runtime_error(
-            "No copies available for checkout.");
+    checkCheckout(availableCopies);
 
     // Safe to decrement - we have at least 1 copy available
     availableCopies--;
 }
 
+void Book::checkCheckout(int availableCopies) {
+    // ===== EDGE CASE: No copies available =====
+    if (availableCopies <= 0)
+        throw std::runtime_error(
+            "No copies available for checkout.");
+}
+
 /**
  * returnBook() - Process a book return (when a user returns a book)
  *
@@ -184,15 +195,28 @@ void Book::checkout() {
  *   book.returnBook();  // THROWS! All 3 copies are already here
  */
 void Book::returnBook() {
+    checkReturn(availableCopies, totalCopies);
+
+    // Safe to increment - at least we have 1 copy that is checked out
+    availableCopies++;
+}
+
+void Book::checkReturn(int availableCopies, int totalCopies) {
     // ===== EDGE CASE: All copies already returned =====
     // If available == total, all books are on the shelf
     // Returning another would create more copies than we own!
     if (availableCopies >= totalCopies)
         throw std::runtime_error(
             "All copies are already in the library.");
+}
 
-    // Safe to increment - at least we have 1 copy that is checked out
-    availableCopies++;
+// matches() - Substring search over title, author and ISBN
+// Example: a book with ISBN "9780132350884" matches "0132"
+
+bool Book::matches(const std::string& keyword) const {
+    return title.find(keyword) != std::string::npos
+        || author.find(keyword) != std::string::npos
+        || isbn.find(keyword) != std::string::npos;
 }
 
 // display() - Prints formatted book information to console
@@ -220,15 +244,21 @@ void Book::display() const {
  * Example output: "B001,Clean Code,Robert Martin,978-0132350884,5,3"
  *
  * Edge Cases Handled:
- * - Titles/authors containireturn CSV formatted string representation of the book
+ * - Titles/authors containing commas or quotes are quoted, with quotes
+ *   doubled: Design Patterns, "GoF" -> "Design Patterns, ""GoF"""
+ * return CSV formatted string representation of the book
  */
 std::string Book::toCSV() const
 {
-    // Build CSV string with comma separators
-    return std::to_string(bookId) + "," +
-            title + "," +
-            author + "," +
-            isbn + "," +
-            std::to_string(totalCopies) + "," +
+    // Build CSV string with comma separators; text fields are quoted
+    // (RFC 4180) when they hold a comma, quote or line break
+    std::string line = std::to_string(bookId) + ",";
+    CsvWriter::appendField(line, title);
+    line += ",";
+    CsvWriter::appendField(line, author);
+    line += ",";
+    CsvWriter::appendField(line, isbn);
+    line += "," + std::to_string(totalCopies) + "," +
             std::to_string(availableCopies);
+    return line;
 }
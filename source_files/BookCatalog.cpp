@@ -0,0 +1,253 @@
+/*
+ BookCatalog.cpp
+ Implementation file for the BookCatalog class (generational slot map
+ over columnar storage) and its BookRef views.
+*/
+
+#include "BookCatalog.h"
+#include <algorithm>
+#include <iostream>
+#include <utility>
+
+// ==================== HANDLE CHECKS ====================
+
+bool BookCatalog::isLive(BookHandle h) const {
+    if (h.slot >= slots.size()) return false;
+
+    // A freed slot's generation has moved on, so old handles fail here
+    const Slot& s = slots[h.slot];
+    return s.generation == h.generation && s.index < size()
+        && denseToSlot[s.index] == h.slot;
+}
+
+// ==================== STRING POOL ====================
+
+BookCatalog::TextSpan BookCatalog::appendText(std::string_view s) {
+    TextSpan span{static_cast<std::uint32_t>(textPool.size()),
+                  static_cast<std::uint32_t>(s.size())};
+    textPool.append(s.data(), s.size());
+    return span;
+}
+
+void BookCatalog::releaseText(TextSpan span) {
+    deadTextBytes += span.length;
+}
+
+// Rebuilds the pool without the dead bytes once they are half of it, so
+// removals can't grow it without bound
+void BookCatalog::compactText() {
+    if (deadTextBytes < 4096 || deadTextBytes * 2 < textPool.size())
+        return;
+
+    std::string fresh;
+    fresh.reserve(textPool.size() - deadTextBytes);
+
+    for (auto* column : {&titles, &isbns}) {
+        for (TextSpan& span : *column) {
+            std::uint32_t offset = static_cast<std::uint32_t>(fresh.size());
+            fresh.append(textPool, span.offset, span.length);
+            span.offset = offset;
+        }
+    }
+
+    textPool.swap(fresh);
+    deadTextBytes = 0;
+}
+
+// ==================== INSERT / ERASE ====================
+
+BookHandle BookCatalog::insert(const Book& b) {
+    return insert(b.getBookId(), b.getTitle(), b.getAuthor(), b.getIsbn(),
+                  b.getTotalCopies(), b.getAvailableCopies());
+}
+
+BookHandle BookCatalog::insert(int id, std::string_view title, std::string_view author,
+                               std::string_view isbn, int total, int available)
+{
+    std::uint32_t slot;
+
+    if (freeHead != BookHandle::NO_SLOT) {
+        // Reuse a freed slot (its generation was bumped when freed)
+        slot = freeHead;
+        freeHead = slots[slot].index;
+    } else {
+        slot = static_cast<std::uint32_t>(slots.size());
+        slots.push_back(Slot{0, 0});
+    }
+
+    slots[slot].index = static_cast<std::uint32_t>(size());
+    denseToSlot.push_back(slot);
+
+    ids.push_back(id);
+    totalCopies.push_back(total);
+    availableCopies.push_back(available);
+    titles.push_back(appendText(title));
+    isbns.push_back(appendText(isbn));
+    isbnKeys.push_back(Isbn::parse(isbn));
+
+    AuthorDictionary::AuthorId authorId = authorDict.intern(author);
+    authorIds.push_back(authorId);
+    authorDict.addBook(authorId, id);
+
+    return BookHandle{slot, slots[slot].generation};
+}
+
+bool BookCatalog::erase(BookHandle h) {
+    if (!isLive(h)) return false;
+
+    std::uint32_t hole = slots[h.slot].index;
+    std::uint32_t last = static_cast<std::uint32_t>(size() - 1);
+
+    releaseText(titles[hole]);
+    releaseText(isbns[hole]);
+    authorDict.removeBook(authorIds[hole], ids[hole]);
+
+    // Move the last book into the hole (every column) and repoint its slot
+    if (hole != last) {
+        ids[hole] = ids[last];
+        totalCopies[hole] = totalCopies[last];
+        availableCopies[hole] = availableCopies[last];
+        titles[hole] = titles[last];
+        isbns[hole] = isbns[last];
+        isbnKeys[hole] = isbnKeys[last];
+        authorIds[hole] = authorIds[last];
+        denseToSlot[hole] = denseToSlot[last];
+        slots[denseToSlot[hole]].index = hole;
+    }
+    ids.pop_back();
+    totalCopies.pop_back();
+    availableCopies.pop_back();
+    titles.pop_back();
+    isbns.pop_back();
+    isbnKeys.pop_back();
+    authorIds.pop_back();
+    denseToSlot.pop_back();
+
+    // Retire the slot: new generation, then onto the free list
+    slots[h.slot].generation++;
+    slots[h.slot].index = freeHead;
+    freeHead = h.slot;
+
+    compactText();
+    return true;
+}
+
+// ==================== LOOKUP ====================
+
+BookRef BookCatalog::get(BookHandle h) {
+    return isLive(h) ? BookRef(this, slots[h.slot].index) : BookRef();
+}
+
+BookRef BookCatalog::get(BookHandle h) const {
+    return isLive(h) ? (*this)[slots[h.slot].index] : BookRef();
+}
+
+std::size_t BookCatalog::positionOf(BookHandle h) const {
+    return isLive(h) ? slots[h.slot].index : size();
+}
+
+BookHandle BookCatalog::handleAt(std::size_t pos) const {
+    std::uint32_t slot = denseToSlot[pos];
+    return BookHandle{slot, slots[slot].generation};
+}
+
+// ==================== COLUMN AGGREGATES ====================
+
+long BookCatalog::sumTotalCopies(std::size_t begin, std::size_t end) const {
+    const int* col = totalCopies.data();
+    long sum = 0;
+    for (std::size_t i = begin; i < end; ++i)
+        sum += col[i];
+    return sum;
+}
+
+long BookCatalog::sumAvailableCopies(std::size_t begin, std::size_t end) const {
+    const int* col = availableCopies.data();
+    long sum = 0;
+    for (std::size_t i = begin; i < end; ++i)
+        sum += col[i];
+    return sum;
+}
+
+int BookCatalog::maxId(std::size_t begin, std::size_t end) const {
+    const int* col = ids.data();
+    int best = 0;
+    for (std::size_t i = begin; i < end; ++i)
+        best = std::max(best, col[i]);
+    return best;
+}
+
+// ==================== CAPACITY ====================
+
+void BookCatalog::reserve(std::size_t n) {
+    slots.reserve(n);
+    denseToSlot.reserve(n);
+    ids.reserve(n);
+    totalCopies.reserve(n);
+    availableCopies.reserve(n);
+    titles.reserve(n);
+    isbns.reserve(n);
+    isbnKeys.reserve(n);
+    authorIds.reserve(n);
+}
+
+void BookCatalog::clear() {
+    slots.clear();
+    denseToSlot.clear();
+    ids.clear();
+    totalCopies.clear();
+    availableCopies.clear();
+    titles.clear();
+    isbns.clear();
+    isbnKeys.clear();
+    authorIds.clear();
+    authorDict.clear();
+    textPool.clear();
+    deadTextBytes = 0;
+    freeHead = BookHandle::NO_SLOT;
+}
+
+// ==================== BOOKREF SETTERS ====================
+
+void BookRef::setTotalCopies(int total) {
+    Book::checkTotalCopies(total, getAvailableCopies());
+    catalog->totalCopies[pos] = total;
+}
+
+void BookRef::setAvailableCopies(int available) {
+    Book::checkAvailableCopies(available, getTotalCopies());
+    catalog->availableCopies[pos] = available;
+}
+
+// ==================== BOOKREF OPERATIONS ====================
+
+void BookRef::checkout() {
+    Book::checkCheckout(getAvailableCopies());
+    catalog->availableCopies[pos]--;
+}
+
+void BookRef::returnBook() {
+    Book::checkReturn(getAvailableCopies(), getTotalCopies());
+    catalog->availableCopies[pos]++;
+}
+
+bool BookRef::matches(std::string_view keyword) const {
+    return getTitle().find(keyword) != std::string_view::npos
+        || getAuthor().find(keyword) != std::string_view::npos
+        || getIsbn().find(keyword) != std::string_view::npos;
+}
+
+Book BookRef::toBook() const {
+    return Book(getBookId(), std::string(getTitle()), std::string(getAuthor()),
+                std::string(getIsbn()), getTotalCopies(), getAvailableCopies());
+}
+
+// Display and CSV go through a Book copy so the format stays in one place
+
+void BookRef::display() const {
+    toBook().display();
+}
+
+std::string BookRef::toCSV() const {
+    return toBook().toCSV();
+}
@@ -0,0 +1,61 @@
+/*
+ BookCursor.cpp
+ Implementation file for the BookCursor class (lazy, paginated results).
+*/
+
+#include "BookCursor.h"
+#include "Library.h"
+#include <utility>
+
+// ==================== CONSTRUCTORS ====================
+
+BookCursor::BookCursor(Library& library, Predicate p)
+    : lib(&library), pred(std::move(p)), useCandidates(false)
+{}
+
+BookCursor::BookCursor(Library& library, Predicate p,
+                       std::vector<std::size_t> candidatePositions)
+    : lib(&library), pred(std::move(p)), useCandidates(true),
+      candidates(std::move(candidatePositions))
+{}
+
+// ==================== HELPERS ====================
+
+std::size_t BookCursor::stepCount() const {
+    return useCandidates ? candidates.size() : lib->getAllBooks().size();
+}
+
+BookRef BookCursor::bookAt(std::size_t step) const {
+    BookCatalog& books = lib->getAllBooks();
+    std::size_t pos = useCandidates ? candidates[step] : step;
+
+    // ===== EDGE CASE: Catalog shrank since the cursor was made =====
+    if (pos >= books.size()) return BookRef();
+    return books[pos];
+}
+
+// Moves `next` onto the next matching step; false when none is left
+bool BookCursor::seekMatch() {
+    for (; next < stepCount(); ++next) {
+        BookRef b = bookAt(next);
+        if (b && pred(b)) return true;
+    }
+    return false;
+}
+
+// ==================== PAGING ====================
+
+std::vector<BookRef> BookCursor::nextPage(std::size_t limit) {
+    std::vector<BookRef> page;
+    page.reserve(limit);
+
+    while (page.size() < limit && seekMatch()) {
+        page.push_back(bookAt(next));
+        ++next;
+    }
+    return page;
+}
+
+bool BookCursor::hasMore() {
+    return seekMatch();
+}
@@ -0,0 +1,103 @@
+/*
+ BookQuery.cpp
+ Implementation file for the BookQuery class (composable book filters).
+*/
+
+#include "BookQuery.h"
+#include <stdexcept>
+
+// ==================== BUILDERS ====================
+
+BookQuery BookQuery::titleContains(const std::string& text) {
+    BookQuery q(Kind::TitleContains);
+    q.text = text;
+    return q;
+}
+
+BookQuery BookQuery::authorEquals(const std::string& author) {
+    BookQuery q(Kind::AuthorEquals);
+    q.text = author;
+    return q;
+}
+
+BookQuery BookQuery::isbnEquals(const std::string& isbn) {
+    BookQuery q(Kind::IsbnEquals);
+    q.text = isbn;
+    q.isbnKey = Isbn::parse(isbn);
+    return q;
+}
+
+BookQuery BookQuery::availableOnly() {
+    return BookQuery(Kind::AvailableOnly);
+}
+
+BookQuery BookQuery::idRange(int lo, int hi) {
+    // ===== EDGE CASE: Reversed bounds =====
+    if (lo > hi)
+        throw std::invalid_argument("ID range lower bound exceeds upper bound.");
+
+    BookQuery q(Kind::IdRange);
+    q.lo = lo;
+    q.hi = hi;
+    return q;
+}
+
+// Joins two queries under `k`, pulling up children of same-kind operands
+static void appendFlattened(std::vector<BookQuery>& out, const BookQuery& q,
+                            BookQuery::Kind k)
+{
+    if (q.getKind() == k)
+        out.insert(out.end(), q.getChildren().begin(), q.getChildren().end());
+    else
+        out.push_back(q);
+}
+
+BookQuery BookQuery::operator&&(const BookQuery& other) const {
+    BookQuery q(Kind::And);
+    appendFlattened(q.children, *this, Kind::And);
+    appendFlattened(q.children, other, Kind::And);
+    return q;
+}
+
+BookQuery BookQuery::operator||(const BookQuery& other) const {
+    BookQuery q(Kind::Or);
+    appendFlattened(q.children, *this, Kind::Or);
+    appendFlattened(q.children, other, Kind::Or);
+    return q;
+}
+
+// ==================== EVALUATION ====================
+
+bool BookQuery::matches(const BookRef& b) const {
+    switch (kind) {
+        case Kind::TitleContains:
+            return b.getTitle().find(text) != std::string_view::npos;
+
+        case Kind::AuthorEquals:
+            return b.getAuthor() == text;
+
+        case Kind::IsbnEquals:
+            // Valid ISBNs compare by key, so "0-13-235088-2" finds the
+            // book stored as "9780132350884"; anything else by text
+            if (isbnKey != Isbn::NONE)
+                return b.getIsbnKey() == isbnKey;
+            return b.getIsbn() == text;
+
+        case Kind::AvailableOnly:
+            return b.isAvailable();
+
+        case Kind::IdRange:
+            return b.getBookId() >= lo && b.getBookId() <= hi;
+
+        case Kind::And:
+            for (const auto& c : children)
+                if (!c.matches(b)) return false;
+            return true;
+
+        case Kind::Or:
+            for (const auto& c : children)
+                if (c.matches(b)) return true;
+            return false;
+    }
+    return false;
+}
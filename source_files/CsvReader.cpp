@@ -0,0 +1,337 @@
+/*
+ CsvReader.cpp
+ Implementation file for the CsvReader and CsvWriter classes (in-place,
+ quote-aware CSV tokenizing and the matching escaping writer).
+
+ A record is scanned in 64-byte windows that start at the record itself,
+ so each record begins outside quotes. Windows that would run past the
+ end of the buffer are copied into a zero-padded block first.
+*/
+
+#include "CsvReader.h"
+#include "SimdScan.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define CSVREADER_X86 1
+#include <immintrin.h>
+#endif
+
+// ==================== CLASSIFIER KERNELS ====================
+
+// Bit i set = byte i of the window is that character
+struct CsvMasks {
+    std::uint64_t quote;
+    std::uint64_t comma;
+    std::uint64_t newline;
+};
+
+static void scalarClassify(const char* p, CsvMasks& m) {
+    m = CsvMasks{0, 0, 0};
+    for (int i = 0; i < 64; ++i) {
+        std::uint64_t bit = std::uint64_t{1} << i;
+        if (p[i] == '"') m.quote |= bit;
+        else if (p[i] == ',') m.comma |= bit;
+        else if (p[i] == '\n') m.newline |= bit;
+    }
+}
+
+#ifdef CSVREADER_X86
+
+static void sse2Classify(const char* p, CsvMasks& m) {
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i comma = _mm_set1_epi8(',');
+    const __m128i newline = _mm_set1_epi8('\n');
+
+    m = CsvMasks{0, 0, 0};
+    for (int k = 0; k < 4; ++k) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16 * k));
+        auto mask = [&](__m128i c) {
+            return static_cast<std::uint64_t>(
+                static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, c)))) << (16 * k);
+        };
+        m.quote |= mask(quote);
+        m.comma |= mask(comma);
+        m.newline |= mask(newline);
+    }
+}
+
+// Bits of one character across a 64-byte window held as two registers
+// (inlined: __m256i arguments would otherwise be passed through memory)
+__attribute__((target("avx2"), always_inline))
+static inline std::uint64_t avx2Mask(__m256i lo, __m256i hi, __m256i c) {
+    std::uint64_t low = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(lo, c)));
+    std::uint64_t high = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(hi, c)));
+    return low | high << 32;
+}
+
+__attribute__((target("avx2")))
+static void avx2Classify(const char* p, CsvMasks& m) {
+    __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 32));
+
+    m.quote = avx2Mask(lo, hi, _mm256_set1_epi8('"'));
+    m.comma = avx2Mask(lo, hi, _mm256_set1_epi8(','));
+    m.newline = avx2Mask(lo, hi, _mm256_set1_epi8('\n'));
+}
+
+#endif // CSVREADER_X86
+
+using ClassifyFn = void (*)(const char*, CsvMasks&);
+
+// Kernel for this CPU, chosen once
+static ClassifyFn classifier() {
+    static const ClassifyFn fn = [] {
+#ifdef CSVREADER_X86
+        switch (SimdScan::activeKernel()) {
+            case SimdScan::Kernel::AVX2: return &avx2Classify;
+            case SimdScan::Kernel::SSE2: return &sse2Classify;
+            case SimdScan::Kernel::Scalar: break;
+        }
+#endif
+        return &scalarClassify;
+    }();
+    return fn;
+}
+
+// Bit i of the result = XOR of bits 0..i: set from an opening quote up to
+// (not including) its closing quote
+static std::uint64_t prefixXor(std::uint64_t x) {
+    x ^= x << 1;
+    x ^= x << 2;
+    x ^= x << 4;
+    x ^= x << 8;
+    x ^= x << 16;
+    x ^= x << 32;
+    return x;
+}
+
+static int popcount(std::uint64_t x) {
+    return __builtin_popcountll(x);
+}
+
+// True if a double quote at `at`, outside quotes, opens a quoted field:
+// it must be the field's first character (lenient RFC 4180 - a quote
+// anywhere else is plain text), or directly follow a closing quote, which
+// makes the pair an escaped quote ("")
+static bool opensQuote(std::string_view text, std::size_t at, std::size_t recordStart,
+                       std::size_t reopenAt) {
+    if (at == recordStart || at == reopenAt) return true;
+    char prev = text[at - 1];
+    return prev == ',' || prev == '\n';
+}
+
+// ==================== READER ====================
+
+bool CsvReader::next(std::string_view* fields, std::size_t maxFields, std::size_t& count) {
+    const ClassifyFn classify = classifier();
+    const std::size_t size = buffer.size();
+
+    while (pos < size) {
+        const std::size_t start = pos;
+        std::size_t fieldStart = start;
+        std::size_t end = size;  // record end (its line break, or end of buffer)
+        bool inQuotes = false;
+        bool ended = false;
+        std::size_t reopenAt = size;  // just past the last closing quote
+
+        line = linesRead + 1;
+        count = 0;
+
+        for (std::size_t base = start; !ended && base < size; base += 64) {
+            const std::size_t n = std::min<std::size_t>(64, size - base);
+
+            CsvMasks m;
+            if (n == 64) {
+                classify(buffer.data() + base, m);
+            } else {
+                char block[64] = {};
+                std::memcpy(block, buffer.data() + base, n);
+                classify(block, m);
+            }
+
+            const std::uint64_t valid = n == 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << n) - 1;
+
+            // ===== EDGE CASE: Stray quotes inside a field =====
+            // Only quotes that open, close or escape a quoted field take
+            // part in the prefix XOR; the rest are plain text. Windows
+            // without quotes (the common case) skip this walk.
+            std::uint64_t quotes = 0;
+            const bool quotedAtStart = inQuotes;
+            for (std::uint64_t q = m.quote & valid; q != 0; q &= q - 1) {
+                const unsigned bit = static_cast<unsigned>(__builtin_ctzll(q));
+                const std::size_t at = base + bit;
+                if (!inQuotes && !opensQuote(buffer, at, start, reopenAt)) continue;
+
+                quotes |= std::uint64_t{1} << bit;
+                if (inQuotes) reopenAt = at + 1;
+                inQuotes = !inQuotes;
+            }
+            const std::uint64_t inside = prefixXor(quotes) ^ (quotedAtStart ? ~std::uint64_t{0} : 0);
+
+            // Commas and line breaks outside quotes
+            std::uint64_t seps = (m.comma | m.newline) & ~inside & valid;
+            while (seps != 0) {
+                const unsigned bit = static_cast<unsigned>(__builtin_ctzll(seps));
+                const std::size_t at = base + bit;
+
+                if (count < maxFields) fields[count] = buffer.substr(fieldStart, at - fieldStart);
+                count++;
+
+                if ((m.newline >> bit) & 1) {
+                    std::uint64_t upTo = bit == 63 ? ~std::uint64_t{0} : (std::uint64_t{2} << bit) - 1;
+                    linesRead += static_cast<std::size_t>(popcount(m.newline & upTo));
+                    end = at;
+                    pos = at + 1;
+                    ended = true;
+                    break;
+                }
+
+                fieldStart = at + 1;
+                seps &= seps - 1;
+            }
+
+            // Line breaks inside quoted fields still count as lines
+            if (!ended) linesRead += static_cast<std::size_t>(popcount(m.newline & valid));
+        }
+
+        // ===== EDGE CASE: Last record has no line break =====
+        if (!ended) {
+            if (count < maxFields) fields[count] = buffer.substr(fieldStart);
+            count++;
+            linesRead++;
+            pos = size;
+        }
+
+        bool crlf = end > start && buffer[end - 1] == '\r';
+
+        // ===== EDGE CASE: Blank line =====
+        if (end - start == (crlf ? 1u : 0u)) continue;
+
+        // Drop the '\r' of a Windows line ending from the last field
+        std::size_t stored = std::min(count, maxFields);
+        if (crlf && count <= maxFields)
+            fields[count - 1].remove_suffix(1);
+
+        // Unquote: "a,b" -> a,b and "say ""hi""" -> say "hi". Unescaped
+        // text is never longer than the record, so `scratch` won't move.
+        scratch.clear();
+        scratch.reserve(end - start);
+        for (std::size_t i = 0; i < stored; ++i) {
+            std::string_view f = fields[i];
+            if (f.size() < 2 || f.front() != '"' || f.back() != '"') continue;
+
+            std::string_view inner = f.substr(1, f.size() - 2);
+            if (inner.find('"') == std::string_view::npos) {
+                fields[i] = inner;
+                continue;
+            }
+
+            std::size_t offset = scratch.size();
+            for (std::size_t j = 0; j < inner.size(); ++j) {
+                scratch += inner[j];
+                if (inner[j] == '"' && j + 1 < inner.size() && inner[j + 1] == '"') ++j;
+            }
+            fields[i] = std::string_view(scratch.data() + offset, scratch.size() - offset);
+        }
+        return true;
+    }
+
+    line = linesRead;
+    return false;
+}
+
+std::size_t CsvReader::countLines(std::string_view text) {
+    std::size_t lines = static_cast<std::size_t>(std::count(text.begin(), text.end(), '\n'));
+    if (!text.empty() && text.back() != '\n') lines++;
+    return lines;
+}
+
+std::vector<std::string_view> CsvReader::splitLines(std::string_view text, std::size_t parts) {
+    std::vector<std::string_view> chunks;
+    std::size_t from = 0;
+
+    // Even byte ranges, each end pushed forward to the next line break
+    // that is outside quotes. Chunks start at a record, so walking the
+    // quotes from `from` with next()'s rules tells which breaks are inside.
+    for (const auto& range : ThreadPool::splitRange(text.size(), parts)) {
+        if (range.second <= from) continue;  // swallowed by a long record
+
+        std::size_t to = text.size();
+        if (range.second < text.size()) {
+            std::size_t at = from;
+            std::size_t reopenAt = text.size();
+            bool inQuotes = false;
+
+            while (true) {
+                std::size_t quote = text.find('"', at);
+
+                if (!inQuotes) {
+                    std::size_t nl = text.find('\n', std::max(at, range.second - 1));
+                    if (nl != std::string_view::npos && nl < quote) {
+                        to = nl + 1;
+                        break;
+                    }
+                    if (quote == std::string_view::npos) break;
+                    inQuotes = opensQuote(text, quote, from, reopenAt);
+                } else {
+                    // ===== EDGE CASE: Unterminated quoted field =====
+                    if (quote == std::string_view::npos) break;
+                    inQuotes = false;
+                    reopenAt = quote + 1;
+                }
+                at = quote + 1;
+            }
+        }
+
+        chunks.push_back(text.substr(from, to - from));
+        from = to;
+        if (from == text.size()) break;
+    }
+
+    if (chunks.empty()) chunks.push_back(text);
+    return chunks;
+}
+
+bool CsvReader::parseInt(std::string_view field, int& out) {
+    if (field.empty()) return false;
+
+    int value = 0;
+    const char* end = field.data() + field.size();
+    auto result = std::from_chars(field.data(), end, value);
+
+    // The whole field must be the number (no "12abc", no overflow)
+    if (result.ec != std::errc() || result.ptr != end) return false;
+    out = value;
+    return true;
+}
+
+// ==================== WRITER ====================
+
+bool CsvWriter::needsQuotes(std::string_view field) {
+    return field.find_first_of(",\"\r\n") != std::string_view::npos;
+}
+
+void CsvWriter::appendField(std::string& out, std::string_view field) {
+    if (!needsQuotes(field)) {
+        out.append(field);
+        return;
+    }
+
+    out += '"';
+    for (char c : field) {
+        if (c == '"') out += '"';  // double every quote
+        out += c;
+    }
+    out += '"';
+}
+
+std::string CsvWriter::escape(std::string_view field) {
+    std::string out;
+    appendField(out, field);
+    return out;
+}
@@ -0,0 +1,38 @@
+/*
+ Date.cpp
+ Implementation file for the Date class (the parts that are not constexpr).
+*/
+
+#include "Date.h"
+#include <ctime>
+
+std::string Date::toString() const {
+    char buf[TEXT_LENGTH];
+    return std::string(buf, format(buf));
+}
+
+void Date::daysLate(const std::int32_t* due, const std::int32_t* returned,
+                    std::size_t n, std::int32_t missing, std::int32_t* out)
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        // Unsigned subtraction: no overflow when a day is `missing`
+        std::int32_t diff = static_cast<std::int32_t>(
+            static_cast<std::uint32_t>(returned[i]) - static_cast<std::uint32_t>(due[i]));
+        bool counts = (returned[i] != missing) & (due[i] != missing) & (diff > 0);
+        out[i] = counts ? diff : 0;
+    }
+}
+
+Date Date::today() {
+    std::time_t now = std::time(nullptr);
+    std::tm local{};
+
+    // Reentrant versions: std::localtime returns a shared static buffer
+#if defined(_WIN32)
+    localtime_s(&local, &now);
+#else
+    localtime_r(&now, &local);
+#endif
+
+    return Date(local.tm_year + 1900, local.tm_mon + 1, local.tm_mday);
+}
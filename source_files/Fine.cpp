@@ -1,29 +1,42 @@
-#include <sstream>
-#include <iomanip>
 #include "Fine.h" // include the Fine class header
 
  
 
 // Constructor that sets the fine amount
-Fine::Fine(double amount_)
+Fine::Fine(Money amount_)
     : amount(amount_) // store the amount in the object
 {}
 
+// Constructor for a fine charged to a user for one transaction
+Fine::Fine(int userId_, int transactionId_, Money amount_)
+    : amount(amount_), userId(userId_), transactionId(transactionId_)
+{}
+
 // Returns the fine amount
-double Fine::getAmount() const { 
+Money Fine::getAmount() const { 
     return amount; 
 }
 
+// Returns the user the fine was charged to
+int Fine::getUserId() const {
+    return userId;
+}
+
+// Returns the transaction the fine was charged for
+int Fine::getTransactionId() const {
+    return transactionId;
+}
+
 // Adds two Fine objects together and returns a new Fine object
+// (the sum belongs to no single transaction; it keeps the user if both match)
 Fine Fine::operator+(const Fine& other) const {
-    return Fine(amount + other.amount); // add amounts from both fines
+    int user = userId == other.userId ? userId : 0;
+    return Fine(user, 0, amount + other.amount); // add amounts from both fines
 }
 
 // Converts the fine amount to a formatted string (example: "5.00")
 std::string Fine::toString() const {
-    std::ostringstream oss; // create a stream to build the string
-    oss << std::fixed << std::setprecision(2) << amount; // keep 2 decimal places
-    return oss.str(); // return string version of amount
+    return amount.toString(); // keep 2 decimal places
 }
 
 // Gisneiry
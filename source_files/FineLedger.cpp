@@ -0,0 +1,107 @@
+/*
+ FineLedger.cpp
+ Implementation file for the FineLedger class (fines keyed by user and
+ transaction).
+*/
+
+#include "FineLedger.h"
+#include "CsvReader.h"
+#include <numeric>
+#include <stdexcept>
+
+// ==================== CHARGES ====================
+
+void FineLedger::append(const Fine& fine, bool isPaid) {
+    int tId = fine.getTransactionId();
+
+    // ===== EDGE CASE: Second fine for the same transaction =====
+    if (tId != 0 && byTransaction.count(tId))
+        throw std::invalid_argument("Transaction " + std::to_string(tId)
+                                    + " already has a fine.");
+
+    if (tId != 0) byTransaction.emplace(tId, cents.size());
+
+    cents.push_back(fine.getAmount().cents());
+    userIds.push_back(fine.getUserId());
+    transactionIds.push_back(tId);
+    paid.push_back(isPaid ? 1 : 0);
+}
+
+void FineLedger::charge(const Fine& fine) {
+    append(fine, false);
+
+    std::int64_t c = fine.getAmount().cents();
+    balances[fine.getUserId()] += c;
+    unpaidCents += c;
+}
+
+void FineLedger::chargePaid(const Fine& fine) {
+    append(fine, true);
+}
+
+bool FineLedger::settle(int transactionId) {
+    auto found = byTransaction.find(transactionId);
+    if (found == byTransaction.end()) return false;
+
+    std::size_t i = found->second;
+    if (paid[i]) return false;
+
+    paid[i] = 1;
+    balances[userIds[i]] -= cents[i];
+    unpaidCents -= cents[i];
+    return true;
+}
+
+// ==================== QUERIES ====================
+
+Money FineLedger::outstanding(int userId) const {
+    auto found = balances.find(userId);
+    return Money::fromCents(found == balances.end() ? 0 : found->second);
+}
+
+Money FineLedger::total() const {
+    return Money::fromCents(std::accumulate(cents.begin(), cents.end(), std::int64_t{0}));
+}
+
+bool FineLedger::findByTransaction(int transactionId, Fine& out) const {
+    auto found = byTransaction.find(transactionId);
+    if (found == byTransaction.end()) return false;
+
+    out = (*this)[found->second];
+    return true;
+}
+
+// ==================== FILE RECORDS ====================
+
+std::string FineLedger::toCSV(std::size_t i) const {
+    return std::to_string(transactionIds[i]) + ","
+         + std::to_string(userIds[i]) + ","
+         + Money::fromCents(cents[i]).toString() + ","
+         + (paid[i] ? "Paid" : "Unpaid");
+}
+
+bool FineLedger::addFromCSV(const std::string_view* fields, std::size_t count) {
+    if (count != CSV_FIELDS) return false;
+
+    int tId = 0, uId = 0;
+    Money amount;
+    if (!CsvReader::parseInt(fields[0], tId) || !CsvReader::parseInt(fields[1], uId)
+        || !Money::parse(fields[2], amount))
+        return false;
+
+    Fine fine(uId, tId, amount);
+    if (fields[3] == "Paid") chargePaid(fine);
+    else if (fields[3] == "Unpaid") charge(fine);
+    else return false;
+    return true;
+}
+
+void FineLedger::clear() {
+    cents.clear();
+    userIds.clear();
+    transactionIds.clear();
+    paid.clear();
+    balances.clear();
+    byTransaction.clear();
+    unpaidCents = 0;
+}
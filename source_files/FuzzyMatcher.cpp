@@ -0,0 +1,98 @@
+/*
+ FuzzyMatcher.cpp
+ Implementation file for the FuzzyMatcher class (approximate substring match).
+*/
+
+#include "FuzzyMatcher.h"
+#include <algorithm>
+#include <cctype>
+
+static unsigned char fold(char c) {
+    return static_cast<unsigned char>(std::tolower(static_cast<unsigned char>(c)));
+}
+
+// ==================== CONSTRUCTOR ====================
+
+FuzzyMatcher::FuzzyMatcher(const std::string& pat) {
+    pattern.reserve(pat.size());
+    for (char c : pat)
+        pattern += static_cast<char>(fold(c));
+
+    // Match masks for the bit-parallel kernel
+    if (pattern.size() <= WORD_BITS) {
+        for (std::size_t i = 0; i < pattern.size(); ++i)
+            peq[static_cast<unsigned char>(pattern[i])] |= std::uint64_t{1} << i;
+    }
+}
+
+// ==================== DISTANCE ====================
+
+int FuzzyMatcher::distance(std::string_view text) const {
+    if (pattern.empty()) return 0;
+
+    if (pattern.size() <= WORD_BITS)
+        return bitParallelDistance(text);
+
+    return dynamicProgrammingDistance(text);
+}
+
+/**
+ * Myers (1999), search variant: Pv/Mv hold the +1/-1 vertical deltas of
+ * the DP column. Row 0 stays 0 for every text position (a match may start
+ * anywhere), so no carry is shifted into the horizontal deltas.
+ * 'score' tracks the last row, i.e. the distance of a match ending here.
+ */
+int FuzzyMatcher::bitParallelDistance(std::string_view text) const {
+    const std::size_t m = pattern.size();
+    const std::uint64_t high = std::uint64_t{1} << (m - 1);
+
+    std::uint64_t pv = ~std::uint64_t{0};
+    std::uint64_t mv = 0;
+    int score = static_cast<int>(m);
+    int best = score;
+
+    for (char c : text) {
+        std::uint64_t eq = peq[fold(c)];
+        std::uint64_t xv = eq | mv;
+        std::uint64_t xh = (((eq & pv) + pv) ^ pv) | eq;
+        std::uint64_t ph = mv | ~(xh | pv);
+        std::uint64_t mh = pv & xh;
+
+        if (ph & high) ++score;
+        else if (mh & high) --score;
+
+        ph <<= 1;
+        mh <<= 1;
+        pv = mh | ~(xv | ph);
+        mv = ph & xv;
+
+        if (score < best) {
+            best = score;
+            if (best == 0) break;  // exact occurrence, can't do better
+        }
+    }
+    return best;
+}
+
+// Plain O(m*n) DP for patterns longer than one machine word
+int FuzzyMatcher::dynamicProgrammingDistance(std::string_view text) const {
+    const std::size_t m = pattern.size();
+    std::vector<int> col(m + 1);
+    for (std::size_t i = 0; i <= m; ++i)
+        col[i] = static_cast<int>(i);
+
+    int best = col[m];
+
+    for (char c : text) {
+        unsigned char tc = fold(c);
+        int diag = col[0];  // row 0 stays 0: a match may start anywhere
+        for (std::size_t i = 1; i <= m; ++i) {
+            int up = col[i];
+            int cost = (static_cast<unsigned char>(pattern[i - 1]) == tc) ? 0 : 1;
+            col[i] = std::min({ col[i - 1] + 1, up + 1, diag + cost });
+            diag = up;
+        }
+        best = std::min(best, col[m]);
+    }
+    return best;
+}
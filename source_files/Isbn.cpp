@@ -0,0 +1,90 @@
+/*
+ Isbn.cpp
+ Implementation file for the Isbn class (ISBN validation and packed keys).
+*/
+
+#include "Isbn.h"
+
+// ==================== PARSING ====================
+
+Isbn::Key Isbn::parse(std::string_view text) {
+    int digits[13];
+    int count = 0;
+
+    for (std::size_t i = 0; i < text.size(); ++i) {
+        char c = text[i];
+
+        if (c == '-' || c == ' ') continue;
+        if (count == 13) return NONE;  // too long
+
+        if (c >= '0' && c <= '9') {
+            digits[count++] = c - '0';
+        }
+        // ===== EDGE CASE: 'X' check digit (value 10) =====
+        // Only valid as the last character of an ISBN-10
+        else if ((c == 'X' || c == 'x') && count == 9) {
+            digits[count++] = 10;
+        }
+        else {
+            return NONE;
+        }
+    }
+
+    // ===== EDGE CASE: All zeros =====
+    // "0000000000" and "0000000000000" pass their checksums but are not
+    // ISBNs (the 13-digit one would also collide with NONE)
+    bool allZero = true;
+    for (int i = 0; i < count; ++i) {
+        if (digits[i] != 0) allZero = false;
+    }
+    if (allZero) return NONE;
+
+    if (count == 10) {
+        // ISBN-10: sum of digit * weight (10 down to 1) is a multiple of 11
+        int sum = 0;
+        for (int i = 0; i < 10; ++i)
+            sum += digits[i] * (10 - i);
+        if (sum % 11 != 0) return NONE;
+
+        // Re-express as ISBN-13: "978" + first 9 digits + new check digit
+        int isbn13[13] = {9, 7, 8};
+        for (int i = 0; i < 9; ++i)
+            isbn13[3 + i] = digits[i];
+
+        int s = 0;
+        for (int i = 0; i < 12; ++i)
+            s += isbn13[i] * (i % 2 == 0 ? 1 : 3);
+        isbn13[12] = (10 - s % 10) % 10;
+
+        Key key = 0;
+        for (int d : isbn13)
+            key = key * 10 + static_cast<Key>(d);
+        return key;
+    }
+
+    if (count == 13) {
+        // ISBN-13: weights alternate 1, 3; the total is a multiple of 10
+        int sum = 0;
+        Key key = 0;
+        for (int i = 0; i < 13; ++i) {
+            if (digits[i] == 10) return NONE;  // 'X' is ISBN-10 only
+            sum += digits[i] * (i % 2 == 0 ? 1 : 3);
+            key = key * 10 + static_cast<Key>(digits[i]);
+        }
+        if (sum % 10 != 0) return NONE;
+        return key;
+    }
+
+    return NONE;
+}
+
+// ==================== FORMATTING ====================
+
+std::string Isbn::toString(Key key) {
+    std::string out(13, '0');
+    for (int i = 12; i >= 0; --i) {
+        out[static_cast<std::size_t>(i)] = static_cast<char>('0' + key % 10);
+        key /= 10;
+    }
+    return out;
+}
@@ -0,0 +1,131 @@
+/*
+ KeywordIndex.cpp
+ Implementation file for the KeywordIndex class (inverted word index).
+*/
+
+#include "KeywordIndex.h"
+#include <algorithm>
+#include <cctype>
+
+// ==================== TOKENIZER ====================
+
+std::vector<std::string> KeywordIndex::tokenize(std::string_view text) {
+    std::vector<std::string> words;
+    std::string current;
+
+    for (unsigned char c : text) {
+        if (std::isalnum(c)) {
+            current += static_cast<char>(std::tolower(c));
+        } else if (!current.empty()) {
+            words.push_back(current);
+            current.clear();
+        }
+    }
+    if (!current.empty())
+        words.push_back(current);
+
+    std::sort(words.begin(), words.end());
+    words.erase(std::unique(words.begin(), words.end()), words.end());
+    return words;
+}
+
+// ==================== INDEX MAINTENANCE ====================
+
+// Words of a book: title and author tokenized together, so a word in
+// both is listed once
+static std::vector<std::string> bookWords(std::string_view title,
+                                          std::string_view author)
+{
+    std::string text;
+    text.reserve(title.size() + 1 + author.size());
+    text.append(title).append(1, ' ').append(author);
+    return KeywordIndex::tokenize(text);
+}
+
+void KeywordIndex::addBook(int bookId, std::string_view title,
+                           std::string_view author)
+{
+    std::vector<std::string> words = bookWords(title, author);
+
+    for (const auto& w : words) {
+        std::vector<int>& list = postings[w];
+
+        // New books get increasing IDs, so appending is the common case
+        if (list.empty() || list.back() < bookId) {
+            list.push_back(bookId);
+            continue;
+        }
+
+        auto pos = std::lower_bound(list.begin(), list.end(), bookId);
+        if (pos == list.end() || *pos != bookId)
+            list.insert(pos, bookId);
+    }
+}
+
+void KeywordIndex::removeBook(int bookId, std::string_view title,
+                              std::string_view author)
+{
+    std::vector<std::string> words = bookWords(title, author);
+
+    for (const auto& w : words) {
+        auto it = postings.find(w);
+        if (it == postings.end()) continue;
+
+        std::vector<int>& list = it->second;
+        auto pos = std::lower_bound(list.begin(), list.end(), bookId);
+        if (pos != list.end() && *pos == bookId)
+            list.erase(pos);
+
+        if (list.empty())
+            postings.erase(it);
+    }
+}
+
+void KeywordIndex::clear() {
+    postings.clear();
+}
+
+// ==================== QUERY ====================
+
+std::vector<int> KeywordIndex::search(const std::string& query) const {
+    std::vector<std::string> words = tokenize(query);
+    if (words.empty()) return {};
+
+    // Collect the posting list of every query word
+    std::vector<const std::vector<int>*> lists;
+    for (const auto& w : words) {
+        auto it = postings.find(w);
+
+        // ===== EDGE CASE: Unknown word =====
+        // Nothing can contain every word, so the result is empty
+        if (it == postings.end()) return {};
+
+        lists.push_back(&it->second);
+    }
+
+    // Intersect starting from the shortest list so the working set
+    // never grows beyond the rarest word's postings
+    std::sort(lists.begin(), lists.end(),
+              [](const std::vector<int>* a, const std::vector<int>* b) {
+                  return a->size() < b->size();
+              });
+
+    std::vector<int> result = *lists[0];
+
+    for (std::size_t i = 1; i < lists.size() && !result.empty(); ++i) {
+        const std::vector<int>& list = *lists[i];
+        auto from = list.begin();
+        std::size_t kept = 0;
+
+        for (int id : result) {
+            // Both lists are sorted: keep searching from the last hit
+            from = std::lower_bound(from, list.end(), id);
+            if (from == list.end()) break;
+            if (*from == id)
+                result[kept++] = id;
+        }
+        result.resize(kept);
+    }
+
+    return result;
+}
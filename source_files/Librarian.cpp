@@ -13,7 +13,7 @@
 #include <iomanip>
 #include <limits>
 #include <stdexcept>                // For exceptions
-#include <ctime>                    // For getting current date
+#include "../headers/Date.h"        // For today's date and due dates
 
 // ==================== CONSTRUCTORS ====================
 
@@ -98,9 +98,10 @@ void Librarian::menu() {
         std::cout << "  [2] Process Return\n";
         std::cout << "  [3] View All Transactions\n";
         std::cout << "  [4] Generate Report\n";
-        std::cout << "  [5] Exit to Main Menu\n";
+        std::cout << "  [5] Record Fine Payment\n";
+        std::cout << "  [6] Exit to Main Menu\n";
         std::cout << "============================================\n";
-        std::cout << "Enter your choice (1-5): ";
+        std::cout << "Enter your choice (1-6): ";
 
         // ===== INPUT HANDLING WITH EDGE CASES =====
         std::cin >> choice;
@@ -113,7 +114,7 @@ void Librarian::menu() {
             // Discard invalid input from the buffer
             std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
 
-            std::cout << "\n[ERROR] Invalid input! Please enter a number (1-5).\n";
+            std::cout << "\n[ERROR] Invalid input! Please enter a number (1-6).\n";
             continue;  // Go back to start of loop
         }
 
@@ -147,14 +148,20 @@ void Librarian::menu() {
                 break;
 
             case 5:
+                // Mark a fine paid
+                std::cout << "\n--- Record Fine Payment ---\n";
+                recordFinePayment();
+                break;
+
+            case 6:
                 // Exit menu
                 std::cout << "\nReturning to main menu...\n";
                 return;  // Exit the menu() function
 
             default:
                 // ===== EDGE CASE: Out of range choice =====
-                // User entered a number, but not 1-5
-                std::cout << "\n[ERROR] Invalid choice! Please select 1-5.\n";
+                // User entered a number, but not 1-6
+                std::cout << "\n[ERROR] Invalid choice! Please select 1-6.\n";
                 break;
         }
     }
@@ -166,11 +173,7 @@ void Librarian::menu() {
  * Helper function to get current date as YYYY-MM-DD string
  */
 static std::string getCurrentDate() {
-    std::time_t now = std::time(nullptr);
-    std::tm* tm = std::localtime(&now);
-    char buffer[11];
-    std::strftime(buffer, sizeof(buffer), "%Y-%m-%d", tm);
-    return std::string(buffer);
+    return Date::today().toString();
 }
 
 /**
@@ -178,19 +181,13 @@ static std::string getCurrentDate() {
  * Returns new date as YYYY-MM-DD string
  */
 static std::string addDays(const std::string& dateStr, int days) {
-    int y, m, d;
-    sscanf(dateStr.c_str(), "%d-%d-%d", &y, &m, &d);
-
-    std::tm tm = {};
-    tm.tm_year = y - 1900;
-    tm.tm_mon = m - 1;
-    tm.tm_mday = d + days;
+    Date date;
 
-    std::mktime(&tm);  // Normalizes the date
+    // ===== EDGE CASE: Unparseable date =====
+    if (!Date::parse(dateStr, date))
+        return dateStr;
 
-    char buffer[11];
-    std::strftime(buffer, sizeof(buffer), "%Y-%m-%d", &tm);
-    return std::string(buffer);
+    return date.plusDays(days).toString();
 }
 
 /**
@@ -239,13 +236,13 @@ void Librarian::processCheckout() {
 
     try {
         // Find the book first to display its title
-        Book* book = Library::instance().findBookById(bookId);
+        BookRef book = Library::instance().findBookById(bookId);
         if (!book) {
             throw std::runtime_error("Book not found with ID: " + std::to_string(bookId));
         }
 
         if (!book->isAvailable()) {
-            throw std::runtime_error("No copies available for: " + book->getTitle());
+            throw std::runtime_error("No copies available for: " + std::string(book->getTitle()));
         }
 
         // Create transaction via Library (handles book checkout internally)
@@ -274,9 +271,9 @@ void Librarian::processCheckout() {
  *
  * Workflow:
  * 1. Prompt for Transaction ID (integer)
- * 2. Find transaction in Library
- * 3. Process return via Library::processReturn()
- * 4. Display fine information if applicable
+ * 2. Process return via Library::processReturn(), which looks up the
+ *    transaction by ID and returns it along with the fine
+ * 3. Display fine information if applicable
  *
  * Edge Cases Handled:
  * - Invalid transaction ID input
@@ -301,21 +298,12 @@ void Librarian::processReturn() {
 
     try {
         // Process return via Library (handles transaction update and book return)
-        Fine fine = Library::instance().processReturn(transactionId, returnDate);
-
-        // Get the transaction to display details
-        auto& transactions = Library::instance().getTransactions();
-        Transaction* trans = nullptr;
-        for (auto& t : transactions) {
-            if (t.getTransactionId() == transactionId) {
-                trans = &t;
-                break;
-            }
-        }
+        // The result carries the completed transaction, so no second lookup
+        ReturnResult result = Library::instance().processReturn(transactionId, returnDate);
 
         // Calculate days late for display
-        int daysLate = trans ? trans->calculateDaysLate() : 0;
-        double fineAmount = fine.getAmount();
+        int daysLate = result.transaction.calculateDaysLate();
+        Money fineAmount = result.fine.getAmount();
 
         // Display success message
         std::cout << "\n";
@@ -327,7 +315,7 @@ void Librarian::processReturn() {
 
         if (daysLate > 0) {
             std::cout << "Days Late: " << daysLate << "\n";
-            std::cout << "Late Fee: $" << std::fixed << std::setprecision(2) << fineAmount << "\n";
+            std::cout << "Late Fee: $" << fineAmount << "\n";
             std::cout << "Status: Returned-Late\n";
         } else {
             std::cout << "Days Late: 0 (On time!)\n";
@@ -348,7 +336,7 @@ void Librarian::processReturn() {
  * With FINE_PER_DAY = $0.50
  *
  * @param daysLate - Number of days the book is overdue
- * @return Fine amount in dollars
+ * @return Fine amount (exact cents)
  *
  * Examples:
  *   calculateFine(0) returns 0.00
@@ -360,16 +348,16 @@ void Librarian::processReturn() {
  * - Negative days: Returns 0 (shouldn't charge negative fine)
  * - Zero days: Returns 0 (no fine for on-time return)
  */
-double Librarian::calculateFine(int daysLate) const {
+Money Librarian::calculateFine(int daysLate) const {
     // ===== EDGE CASE: Negative or zero days late =====
     // Cannot have negative fine, and 0 days late means no fine
     if (daysLate <= 0) {
-        return 0.0;
+        return Money();
     }
 
     // Calculate fine using the constant rate
-    // FINE_PER_DAY is defined in the header as 0.50
-    double fineAmount = daysLate * FINE_PER_DAY;
+    // FINE_PER_DAY is Fine::PER_DAY ($0.50)
+    Money fineAmount = FINE_PER_DAY * daysLate;
 
     return fineAmount;
 }
@@ -408,8 +396,11 @@ void Librarian::viewAllTransactions() const {
     std::cout << "--------------------------------------------"
               << "--------------------------------------------\n";
 
-    // Count statistics
-    int activeCount = 0, returnedCount = 0, lateCount = 0;
+    // Status counts come from Library's running totals
+    const LibraryStats& stats = Library::instance().stats();
+    int activeCount = stats.activeLoans;
+    int returnedCount = stats.returned;
+    int lateCount = stats.lateReturns;
 
     // Display each transaction
     for (const auto& trans : transactions) {
@@ -421,11 +412,6 @@ void Librarian::viewAllTransactions() const {
                   << std::setw(14) << trans.getDueDate()
                   << std::setw(14) << (trans.getReturnDate().empty() ? "-" : trans.getReturnDate())
                   << trans.getStatus() << "\n";
-
-        // Count by status
-        if (trans.getStatus() == "Active") activeCount++;
-        else if (trans.getStatus() == "Returned") returnedCount++;
-        else if (trans.getStatus() == "Returned-Late") lateCount++;
     }
 
     std::cout << "--------------------------------------------"
@@ -449,45 +435,31 @@ void Librarian::viewAllTransactions() const {
  */
 void Librarian::generateReport() const {
     // Get data from Library singleton
-    auto& books = Library::instance().getAllBooks();
     auto& transactions = Library::instance().getTransactions();
-    auto& fines = Library::instance().getFines();
 
-    // Calculate book statistics
-    int totalTitles = static_cast<int>(books.size());
-    int totalCopies = 0;
-    int availableCopies = 0;
+    // Running totals kept by Library: no scan of books, loans or fines
+    const LibraryStats& stats = Library::instance().stats();
 
-    for (const auto& book : books) {
-        totalCopies += book.getTotalCopies();
-        availableCopies += book.getAvailableCopies();
-    }
+    // Book statistics
+    int totalTitles = stats.titles;
+    long totalCopies = stats.totalCopies;
+    long availableCopies = stats.availableCopies;
 
-    int checkedOutCopies = totalCopies - availableCopies;
+    long checkedOutCopies = totalCopies - availableCopies;
 
-    // Calculate transaction statistics
+    // Transaction statistics
     int totalTransactions = static_cast<int>(transactions.size());
-    int activeCount = 0;
-    int returnedCount = 0;
-    int lateCount = 0;
+    int activeCount = stats.activeLoans;
+    int returnedCount = stats.returned;
+    int lateCount = stats.lateReturns;
+    long totalDaysLate = stats.daysLate;
 
-    std::string today = getCurrentDate();
+    // Active loans already past their due date (from the due-date index)
+    int overdueCount = Library::instance().countOverdue(Date::today());
 
-    for (const auto& trans : transactions) {
-        if (trans.getStatus() == "Active") {
-            activeCount++;
-        } else if (trans.getStatus() == "Returned") {
-            returnedCount++;
-        } else if (trans.getStatus() == "Returned-Late") {
-            lateCount++;
-        }
-    }
-
-    // Calculate fine statistics
-    double totalFinesAmount = 0.0;
-    for (const auto& fine : fines) {
-        totalFinesAmount += fine.getAmount();
-    }
+    // Fine statistics
+    Money totalFinesAmount = stats.fineTotal;
+    Money unpaidAmount = Library::instance().getFines().outstandingTotal();
 
     // Display report
     std::cout << "\n";
@@ -506,14 +478,71 @@ void Librarian::generateReport() const {
     std::cout << "TRANSACTION SUMMARY\n";
     std::cout << "  Total Transactions: " << totalTransactions << "\n";
     std::cout << "  Active Rentals: " << activeCount << "\n";
+    std::cout << "  Overdue Now: " << overdueCount << "\n";
     std::cout << "  Completed Returns: " << returnedCount << "\n";
     std::cout << "  Late Returns: " << lateCount << "\n";
+    std::cout << "  Total Days Late: " << totalDaysLate << "\n";
     std::cout << "\n";
 
     std::cout << "FINANCIAL SUMMARY\n";
-    std::cout << "  Total Fines Collected: $" << std::fixed << std::setprecision(2)
-              << totalFinesAmount << "\n";
-    std::cout << "  Number of Fines: " << fines.size() << "\n";
+    std::cout << "  Total Fines Collected: $" << totalFinesAmount << "\n";
+    std::cout << "  Outstanding (unpaid): $" << unpaidAmount << "\n";
+    std::cout << "  Number of Fines: " << stats.fineCount << "\n";
     std::cout << "\n";
     std::cout << "============================================\n";
 }
+
+/**
+ * recordFinePayment - Mark a transaction's fine as paid
+ *
+ * Workflow:
+ * 1. Prompt for Transaction ID (integer)
+ * 2. Look up its fine in the ledger
+ * 3. Settle it via Library::payFine()
+ * 4. Display the amount paid and the borrower's remaining balance
+ *
+ * Edge Cases Handled:
+ * - Invalid transaction ID input
+ * - Transaction has no fine
+ * - Fine already paid
+ */
+void Librarian::recordFinePayment() {
+    int transactionId = 0;
+
+    // Get Transaction ID (integer)
+    std::cout << "Enter Transaction ID (integer): ";
+    if (!(std::cin >> transactionId)) {
+        std::cin.clear();
+        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+        std::cout << "[ERROR] Invalid Transaction ID. Must be an integer.\n";
+        return;
+    }
+    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+
+    Library& library = Library::instance();
+
+    // ===== EDGE CASE: No fine for this transaction =====
+    Fine fine;
+    if (!library.getFines().findByTransaction(transactionId, fine)) {
+        std::cout << "[ERROR] Transaction " << transactionId << " has no fine.\n";
+        return;
+    }
+
+    // ===== EDGE CASE: Fine already paid =====
+    if (!library.payFine(transactionId)) {
+        std::cout << "[ERROR] The fine for transaction " << transactionId
+                  << " is already paid.\n";
+        return;
+    }
+
+    std::cout << "\n";
+    std::cout << "========================================\n";
+    std::cout << "        FINE PAID                       \n";
+    std::cout << "========================================\n";
+    std::cout << "Transaction ID: " << transactionId << "\n";
+    std::cout << "User ID: " << fine.getUserId() << "\n";
+    std::cout << "Amount Paid: $" << fine.getAmount() << "\n";
+    std::cout << "Remaining Balance: $"
+              << library.outstandingFines(fine.getUserId()) << "\n";
+    std::cout << "========================================\n";
+}
@@ -1,9 +1,16 @@
 #include "Library.h"
+#include "FuzzyMatcher.h"
+#include "Date.h"
+#include "MappedFile.h"
+#include "CsvReader.h"
+#include "Snapshot.h"
+#include "ThreadPool.h"
 #include <fstream>
-#include <sstream>
+#include <iostream>
 #include <algorithm>
+#include <climits>
 #include <stdexcept>
-#include <ctime>
+#include <iterator>
 
 // ==================== CONSTRUCTOR ====================
 
@@ -18,12 +25,46 @@ Library& Library::instance() {
 
 // ==================== BOOK LOOKUP ====================
 
-Book* Library::findBookById(int id) {
-    for (auto& b : books) {
-        if (b.getBookId() == id)
-            return &b;
+BookRef Library::findBookById(int id) {
+    auto it = bookIndex.find(id);
+    if (it == bookIndex.end())
+        return BookRef();
+    return books.get(it->second);
+}
+
+BookRef Library::findBookByIsbn(const std::string& isbn) {
+    Isbn::Key key = Isbn::parse(isbn);
+    if (key == Isbn::NONE)
+        return BookRef();
+
+    auto it = isbnIndex.find(key);
+    if (it == isbnIndex.end())
+        return BookRef();
+    return books.get(it->second);
+}
+
+BookHandle Library::findBookHandle(int id) const {
+    auto it = bookIndex.find(id);
+    if (it == bookIndex.end())
+        return BookHandle{};
+    return it->second;
+}
+
+BookRef Library::resolve(BookHandle handle) {
+    return books.get(handle);
+}
+
+std::vector<std::size_t> Library::catalogPositions(const std::vector<int>& ids) const {
+    std::vector<std::size_t> positions;
+    positions.reserve(ids.size());
+
+    for (int id : ids) {
+        auto it = bookIndex.find(id);
+        if (it != bookIndex.end())
+            positions.push_back(books.positionOf(it->second));
     }
-    return nullptr;
+    std::sort(positions.begin(), positions.end());
+    return positions;
 }
 
 // ==================== ADD BOOK ====================
@@ -36,12 +77,38 @@ int Library::addBook(const std::string& title,
     if (copies < 0)
         throw std::invalid_argument("Copies cannot be negative");
 
+    // ===== EDGE CASE: Malformed or duplicate ISBN =====
+    // Empty is allowed (older books have none); anything else must be a
+    // real ISBN that no other book already has
+    Isbn::Key key = Isbn::parse(isbn);
+    if (!isbn.empty() && key == Isbn::NONE)
+        throw std::invalid_argument("Invalid ISBN: " + isbn);
+
+    auto taken = isbnIndex.find(key);
+    if (key != Isbn::NONE && taken != isbnIndex.end() && books.get(taken->second))
+        throw std::invalid_argument("ISBN " + isbn + " already belongs to book ID "
+            + std::to_string(books.get(taken->second).getBookId()));
+
+    std::string storedIsbn = key == Isbn::NONE ? isbn : Isbn::toString(key);
     int newId = nextBookId++;
 
     // totalCopies = copies, availableCopies = copies at creation
-    Book bk(newId, title, author, isbn, copies, copies);
-
-    books.push_back(bk);
+    Book bk(newId, title, author, storedIsbn, copies, copies);
+
+    BookHandle h = books.insert(bk);
+    bookIndex[newId] = h;
+    if (key != Isbn::NONE)
+        isbnIndex[key] = h;
+    if (!keywordIndexPending)
+        keywordIndex.addBook(newId, title, author);
+    if (!trigramIndexPending)
+        trigramIndex.addBook(newId, title, author, storedIsbn);
+    if (!autocompletePending)
+        autocomplete.addBook(newId, title, author);
+
+    statsCache.titles++;
+    statsCache.totalCopies += copies;
+    statsCache.availableCopies += copies;
 
     return newId;
 }
@@ -49,20 +116,275 @@ int Library::addBook(const std::string& title,
 // ==================== REMOVE BOOK ====================
 
 bool Library::removeBook(int id) {
-    auto it = std::remove_if(books.begin(), books.end(),
-        [&](const Book& b) {
-            return b.getBookId() == id;
-        });
+    auto found = bookIndex.find(id);
+    if (found == bookIndex.end()) return false;
+
+    BookHandle h = found->second;
+    BookRef b = books.get(h);
+    if (b) {
+        std::string title(b.getTitle()), author(b.getAuthor()), isbn(b.getIsbn());
+        if (!keywordIndexPending)
+            keywordIndex.removeBook(id, title, author);
+        if (!trigramIndexPending)
+            trigramIndex.removeBook(id, title, author, isbn);
+        if (!autocompletePending)
+            autocomplete.removeBook(id, title, author);
+
+        auto byIsbn = isbnIndex.find(b.getIsbnKey());
+        if (byIsbn != isbnIndex.end() && byIsbn->second.slot == h.slot
+            && byIsbn->second.generation == h.generation)
+            isbnIndex.erase(byIsbn);
+
+        statsCache.titles--;
+        statsCache.totalCopies -= b.getTotalCopies();
+        statsCache.availableCopies -= b.getAvailableCopies();
+    }
+
+    bookIndex.erase(found);
+    books.erase(h);  // O(1): no other book's handle changes
+
+    // ===== EDGE CASE: The loaded file repeated this ID =====
+    auto repeated = repeatedIds.find(id);
+    if (repeated != repeatedIds.end()) {
+        for (BookHandle extra : repeated->second) {
+            BookRef r = books.get(extra);
+            if (!r) continue;
+            statsCache.titles--;
+            statsCache.totalCopies -= r.getTotalCopies();
+            statsCache.availableCopies -= r.getAvailableCopies();
+            books.erase(extra);
+        }
+        repeatedIds.erase(repeated);
+    }
+    return true;
+}
+
+// ==================== KEYWORD SEARCH ====================
+
+std::vector<BookRef> Library::searchByKeywords(const std::string& query) {
+    ensureKeywordIndex();
+    std::vector<BookRef> results;
+
+    for (int id : keywordIndex.search(query)) {
+        BookRef b = findBookById(id);
+        if (b) results.push_back(b);
+    }
+    return results;
+}
+
+// ==================== AUTHOR LOOKUP ====================
+
+std::vector<BookRef> Library::booksByAuthor(const std::string& author) {
+    const AuthorDictionary& dict = books.authors();
+    AuthorDictionary::AuthorId authorId = dict.find(author);
+    const std::vector<int>& ids = dict.booksBy(authorId);
+
+    std::vector<BookRef> results;
+    results.reserve(ids.size());
+    for (int id : ids) {
+        // The ID check skips a repeated book ID from a hand-edited CSV
+        BookRef b = findBookById(id);
+        if (b && b.getAuthorId() == authorId) results.push_back(b);
+    }
+    return results;
+}
+
+// ==================== SUBSTRING SEARCH ====================
 
-    if (it == books.end()) return false;
+std::vector<BookRef> Library::searchSubstring(const std::string& text) {
+    ensureTrigramIndex();
+    std::vector<int> ids;
+
+    // Too short for the trigram filter: fall back to the full scan
+    if (!trigramIndex.candidates(text, ids)) {
+        return searchBooks([&](const BookRef& b) { return b.matches(text); });
+    }
+
+    // Verify candidates in catalog order so results match the scan
+    std::vector<BookRef> results;
+    for (std::size_t pos : catalogPositions(ids)) {
+        if (books[pos].matches(text))
+            results.push_back(books[pos]);
+    }
+    return results;
+}
+
+BookCursor Library::searchSubstringCursor(const std::string& text) {
+    ensureTrigramIndex();
+    auto pred = [text](const BookRef& b) { return b.matches(text); };
+
+    // A broad query would copy and sort a huge candidate list before the
+    // first page; past the bound the lazy scan is cheaper
+    std::vector<int> ids;
+    if (!trigramIndex.candidates(text, ids, BookCursor::MAX_CANDIDATES))
+        return BookCursor(*this, pred);
+
+    return BookCursor(*this, pred, catalogPositions(ids));
+}
+
+// ==================== QUERY PLANNER ====================
+
+bool Library::planCandidates(const BookQuery& query,
+                             std::vector<int>& ids) const
+{
+    ids.clear();
+
+    switch (query.getKind()) {
+        case BookQuery::Kind::TitleContains:
+            // Trigram postings cover title, author and ISBN
+            return trigramIndex.candidates(query.getText(), ids);
+
+        case BookQuery::Kind::IsbnEquals: {
+            // A valid ISBN is one probe of the unique ISBN index
+            if (query.getIsbnKey() != Isbn::NONE) {
+                auto it = isbnIndex.find(query.getIsbnKey());
+                if (it != isbnIndex.end()) {
+                    BookRef b = books.get(it->second);
+                    if (b) ids.push_back(b.getBookId());
+                }
+                return true;
+            }
+            // Legacy (invalid) ISBN text: fall back to the trigram filter
+            return trigramIndex.candidates(query.getText(), ids);
+        }
+
+        case BookQuery::Kind::AuthorEquals: {
+            // Exact postings from the interned author dictionary
+            const AuthorDictionary& dict = books.authors();
+            ids = dict.booksBy(dict.find(query.getText()));
+            return true;
+        }
+
+        case BookQuery::Kind::IdRange: {
+            // Probe the ID index only when the range is smaller than the catalog
+            long span = static_cast<long>(query.getHi()) - query.getLo() + 1;
+            if (span > static_cast<long>(books.size()))
+                return false;
+            for (int id = query.getLo(); id <= query.getHi(); ++id) {
+                if (bookIndex.count(id))
+                    ids.push_back(id);
+                if (id == query.getHi()) break;  // guard INT_MAX wraparound
+            }
+            return true;
+        }
+
+        case BookQuery::Kind::AvailableOnly:
+            return false;  // no index on copy counts
+
+        case BookQuery::Kind::And: {
+            // Any indexed child bounds the result; use the smallest one
+            bool found = false;
+            std::vector<int> childIds;
+            for (const auto& child : query.getChildren()) {
+                if (!planCandidates(child, childIds)) continue;
+                if (!found || childIds.size() < ids.size()) {
+                    ids.swap(childIds);
+                    found = true;
+                }
+                if (ids.empty()) break;  // nothing can match
+            }
+            return found;
+        }
+
+        case BookQuery::Kind::Or: {
+            // Every child needs an index, otherwise the union is unbounded
+            std::vector<int> childIds, merged;
+            for (const auto& child : query.getChildren()) {
+                if (!planCandidates(child, childIds)) {
+                    ids.clear();
+                    return false;
+                }
+                merged.clear();
+                std::set_union(ids.begin(), ids.end(),
+                               childIds.begin(), childIds.end(),
+                               std::back_inserter(merged));
+                ids.swap(merged);
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+std::vector<BookRef> Library::runQuery(const BookQuery& query) {
+    ensureTrigramIndex();  // the planner's substring filter
+    std::vector<int> ids;
+
+    if (!planCandidates(query, ids)) {
+        return searchBooks([&](const BookRef& b) { return query.matches(b); });
+    }
+
+    // Verify candidates in catalog order so results match the scan
+    std::vector<BookRef> results;
+    for (std::size_t pos : catalogPositions(ids)) {
+        if (query.matches(books[pos]))
+            results.push_back(books[pos]);
+    }
+    return results;
+}
 
-    books.erase(it, books.end());
+// ==================== FUZZY SEARCH ====================
+
+std::vector<FuzzyMatch> Library::fuzzySearch(const std::string& query,
+                                             int maxDistance)
+{
+    ensureTrigramIndex();
+    FuzzyMatcher matcher(query);
+    std::vector<std::pair<int, std::size_t>> hits;  // (distance, position)
+
+    auto check = [&](std::size_t pos) {
+        BookRef b = books[pos];
+        int d = std::min(matcher.distance(b.getTitle()),
+                         matcher.distance(b.getAuthor()));
+        if (d <= maxDistance)
+            hits.emplace_back(d, pos);
+    };
+
+    std::vector<int> ids;
+    if (trigramIndex.fuzzyCandidates(query, maxDistance, ids)) {
+        for (std::size_t pos : catalogPositions(ids))
+            check(pos);
+    } else {
+        // Short query or large maxDistance: the filter can't prune
+        for (std::size_t pos = 0; pos < books.size(); ++pos)
+            check(pos);
+    }
+
+    // Closest first, catalog order among equals
+    std::sort(hits.begin(), hits.end());
+
+    std::vector<FuzzyMatch> results;
+    results.reserve(hits.size());
+    for (const auto& h : hits)
+        results.push_back(FuzzyMatch{books[h.second], h.first});
+    return results;
+}
+
+// ==================== AUTOCOMPLETE ====================
+
+std::vector<std::string> Library::suggest(const std::string& prefix,
+                                          std::size_t k)
+{
+    ensureAutocomplete();
+    return autocomplete.complete(prefix, k);
+}
+
+// ==================== INVENTORY EDITS ====================
+
+bool Library::setBookTotalCopies(int id, int total) {
+    BookRef b = findBookById(id);
+    if (!b) return false;
+
+    int before = b.getTotalCopies();
+    b.setTotalCopies(total);  // throws before changing anything
+
+    statsCache.totalCopies += total - before;
     return true;
 }
 
 // ==================== GET ALL BOOKS ====================
 
-std::vector<Book>& Library::getAllBooks() {
+BookCatalog& Library::getAllBooks() {
     return books;
 }
 
@@ -73,55 +395,177 @@ int Library::checkoutBook(int userId,
                           const std::string& checkoutDate,
                           const std::string& dueDate)
 {
-    Book* b = findBookById(bookId);
+    BookRef b = findBookById(bookId);
 
     if (!b)
         throw std::runtime_error("Book not found.");
 
-    b->checkout();  // uses Book::checkout() validation
-
-    int tId = nextTransactionId++;
-
+    // Build (and so validate) the transaction first: a bad date or user
+    // ID throws here, before the book, stats, indexes or ID counter change
+    int tId = nextTransactionId;
     Transaction t(tId, userId, bookId, checkoutDate, dueDate);
 
+    b->checkout();  // same validation as Book::checkout()
+    nextTransactionId++;
+    if (!autocompletePending)
+        autocomplete.recordCheckout(bookId, b->getTitle(), b->getAuthor());
+    statsCache.availableCopies--;
+    statsCache.activeLoans++;
+
     transactions.push_back(t);
+    indexTransaction(tId, transactions.size() - 1);
+    activeLoans[userId].push_back(tId);
+    dueIndex.emplace(t.getDueDay(), tId);
 
     return tId;
 }
 
+// ==================== TRANSACTION LOOKUP ====================
+
+void Library::indexTransaction(int transactionId, std::size_t pos) {
+    if (transactionId < 0) return;
+
+    std::size_t id = static_cast<std::size_t>(transactionId);
+
+    // Dense IDs: grow the direct table (at most doubling past the log size)
+    if (id < transactionSlots.size() ||
+        id <= 2 * transactions.size() + 1024) {
+        if (id >= transactionSlots.size())
+            transactionSlots.resize(id + 1, -1);
+        if (transactionSlots[id] < 0)
+            transactionSlots[id] = static_cast<long>(pos);
+        return;
+    }
+
+    sparseTransactionSlots.emplace(transactionId, pos);
+}
+
+Transaction* Library::findTransactionById(int transactionId) {
+    if (transactionId < 0) return nullptr;
+
+    std::size_t id = static_cast<std::size_t>(transactionId);
+    if (id < transactionSlots.size()) {
+        long pos = transactionSlots[id];
+        if (pos >= 0)
+            return &transactions[static_cast<std::size_t>(pos)];
+    }
+
+    auto it = sparseTransactionSlots.find(transactionId);
+    if (it == sparseTransactionSlots.end())
+        return nullptr;
+    return &transactions[it->second];
+}
+
+// ==================== ACTIVE LOANS ====================
+
+void Library::dropActiveLoan(int userId, int transactionId) {
+    auto it = activeLoans.find(userId);
+    if (it == activeLoans.end()) return;
+
+    auto& ids = it->second;
+    ids.erase(std::remove(ids.begin(), ids.end(), transactionId), ids.end());
+
+    if (ids.empty())
+        activeLoans.erase(it);
+}
+
+std::vector<Transaction*> Library::getActiveLoans(int userId) {
+    std::vector<Transaction*> loans;
+
+    auto it = activeLoans.find(userId);
+    if (it == activeLoans.end()) return loans;
+
+    loans.reserve(it->second.size());
+    for (int tId : it->second) {
+        Transaction* t = findTransactionById(tId);
+        if (t) loans.push_back(t);
+    }
+    return loans;
+}
+
+int Library::countActiveLoans(int userId) const {
+    auto it = activeLoans.find(userId);
+    if (it == activeLoans.end()) return 0;
+    return static_cast<int>(it->second.size());
+}
+
+// ==================== DUE DATES ====================
+
+// Active loans with firstDay <= due day <= lastDay, in due-date order
+std::vector<Transaction*> Library::loansDueIn(std::int32_t firstDay,
+                                              std::int32_t lastDay)
+{
+    std::vector<Transaction*> loans;
+    if (firstDay > lastDay) return loans;
+
+    auto it = dueIndex.lower_bound({firstDay, INT_MIN});
+    for (; it != dueIndex.end() && it->first <= lastDay; ++it) {
+        Transaction* t = findTransactionById(it->second);
+        if (t) loans.push_back(t);
+    }
+    return loans;
+}
+
+std::vector<Transaction*> Library::overdueAsOf(Date asOf) {
+    return loansDueIn(INT32_MIN, asOf.dayNumber() - 1);
+}
+
+std::vector<Transaction*> Library::dueWithin(Date from, int days) {
+    return loansDueIn(from.dayNumber(), from.plusDays(days).dayNumber());
+}
+
+int Library::countOverdue(Date asOf) const {
+    auto end = dueIndex.lower_bound({asOf.dayNumber(), INT_MIN});
+    return static_cast<int>(std::distance(dueIndex.begin(), end));
+}
+
 // ==================== PROCESS RETURN ====================
 
-Fine Library::processReturn(int transactionId,
-                            const std::string& returnDate)
+ReturnResult Library::processReturn(int transactionId,
+                                    const std::string& returnDate)
 {
-    auto it = std::find_if(transactions.begin(),
-                           transactions.end(),
-                           [&](const Transaction& tr) {
-                               return tr.getTransactionId() == transactionId;
-                           });
+    Transaction* trans = findTransactionById(transactionId);
 
-    if (it == transactions.end())
+    if (!trans)
         throw std::runtime_error("Transaction not found.");
 
-    if (!it->isActive())
+    if (!trans->isActive())
         throw std::runtime_error("Transaction already completed.");
 
+    // ===== EDGE CASE: Transaction already fined =====
+    // fines.charge would throw at the end, after the loan was closed;
+    // refuse before anything changes instead
+    Fine existing;
+    if (fines.findByTransaction(transactionId, existing))
+        throw std::runtime_error("Transaction already has a fine.");
+
     // Mark the transaction as returned
-    it->completeReturn(returnDate);
+    trans->completeReturn(returnDate);
+    dropActiveLoan(trans->getUserId(), transactionId);
+    dueIndex.erase({trans->getDueDay(), transactionId});
+
+    // The loan is closed even if the copy can't go back on the shelf below
+    int daysLate = trans->calculateDaysLate();
+    statsCache.activeLoans--;
+    if (trans->isLate()) statsCache.lateReturns++;
+    else statsCache.returned++;
+    statsCache.daysLate += daysLate;
 
     // Restore the book copy
-    Book* b = findBookById(it->getBookId());
-    if (b)
+    BookRef b = findBookById(trans->getBookId());
+    if (b) {
         b->returnBook();
+        statsCache.availableCopies++;
+    }
 
-    // Calculate fine
-    int daysLate = it->calculateDaysLate();
-    double amount = daysLate * 0.5;
+    // Charge the fine to the borrower (Fine::PER_DAY per day late)
+    Fine fine(trans->getUserId(), transactionId, Fine::forDaysLate(daysLate));
+    fines.charge(fine);
 
-    Fine fine(amount);
-    fines.push_back(fine);
+    statsCache.fineCount++;
+    statsCache.fineTotal += fine.getAmount();
 
-    return fine;
+    return ReturnResult{*trans, fine};
 }
 
 // ==================== DATE DIFFERENCE ====================
@@ -129,93 +573,303 @@ Fine Library::processReturn(int transactionId,
 int Library::daysBetween(const std::string& d1,
                          const std::string& d2)
 {
-    auto to_tm = [](const std::string& s) {
-        std::tm tm{};
-        int y, m, d;
-        if (sscanf(s.c_str(), "%d-%d-%d", &y, &m, &d) != 3)
-            return tm;
-
-        tm.tm_year = y - 1900;
-        tm.tm_mon = m - 1;
-        tm.tm_mday = d;
-        return tm;
-    };
+    Date from, to;
 
-    std::tm t1 = to_tm(d1);
-    std::tm t2 = to_tm(d2);
+    // ===== EDGE CASE: Unparseable date =====
+    if (!Date::parse(d1, from) || !Date::parse(d2, to))
+        return 0;
 
-    time_t tt1 = mktime(&t1);
-    time_t tt2 = mktime(&t2);
+    return to - from;
+}
 
-    if (tt1 == -1 || tt2 == -1)
-        return 0;
+// ==================== LOAD FROM CSV ====================
 
-    double seconds = difftime(tt2, tt1);
+// Reports a malformed record; the loader skips it and carries on
+static void recordError(const std::string& file, std::size_t line, const std::string& what) {
+    std::cerr << "[ERROR] " << file << ":" << line << ": " << what
+              << " (record skipped)\n";
+}
 
-    return static_cast<int>(seconds / (60 * 60 * 24));
+// "YYYY-MM-DD" field -> day number; empty gives Transaction::NO_DATE
+static bool parseDayField(std::string_view field, std::int32_t& day) {
+    if (field.empty()) {
+        day = Transaction::NO_DATE;
+        return true;
+    }
+    Date date;
+    if (!Date::parse(field, date)) return false;
+    day = date.dayNumber();
+    return true;
 }
 
-// ==================== LOAD FROM CSV ====================
+// One slice of transactions.csv parsed on a worker thread. Records and
+// errors stay in the chunk's own buffers until the in-order merge.
+struct TransactionChunk {
+    std::vector<Transaction> records;
+    std::vector<std::pair<std::size_t, std::string>> errors;  // (line in chunk, reason)
+    std::size_t lines = 0;
+    int maxId = 0;
+};
+
+// Parses whole lines of transactions.csv. Touches no shared state, so
+// chunks can run on any thread.
+static TransactionChunk parseTransactionChunk(std::string_view text) {
+    TransactionChunk chunk;
+    chunk.records.reserve(CsvReader::countLines(text));
+
+    CsvReader reader(text);
+    std::string_view f[7];
+    std::size_t n;
+
+    while (reader.next(f, 7, n)) {
+        std::size_t line = reader.lineNumber();
+
+        if (n != 7) {
+            chunk.errors.emplace_back(line, "expected 7 fields, found " + std::to_string(n));
+            continue;
+        }
+
+        int tid, uid, bid;
+        if (!CsvReader::parseInt(f[0], tid) || !CsvReader::parseInt(f[1], uid)
+            || !CsvReader::parseInt(f[2], bid)) {
+            chunk.errors.emplace_back(line, "transaction, user and book IDs must be whole numbers");
+            continue;
+        }
+
+        std::int32_t checkout, due, returned;
+        if (!parseDayField(f[3], checkout) || !parseDayField(f[4], due)
+            || !parseDayField(f[5], returned)) {
+            chunk.errors.emplace_back(line, "dates must be valid YYYY-MM-DD dates");
+            continue;
+        }
+
+        // Unknown status text is treated as Active, as before
+        bool known;
+        Transaction::Status status = Transaction::parseStatus(f[6], known);
+
+        try {
+            chunk.records.emplace_back(tid, uid, bid, checkout, due, returned, status);
+        } catch (const std::invalid_argument& e) {
+            chunk.errors.emplace_back(line, e.what());
+            continue;
+        }
+
+        chunk.maxId = std::max(chunk.maxId, tid);
+    }
+
+    chunk.lines = reader.lineNumber();
+    return chunk;
+}
+
+// Waits for every queued chunk when it goes out of scope. The chunks read
+// straight from the mapped file, so if loading the books throws, the
+// workers must finish before the mapping is released.
+struct PendingChunks {
+    std::vector<std::future<TransactionChunk>>& futures;
+
+    ~PendingChunks() {
+        for (auto& f : futures)
+            if (f.valid()) f.wait();
+    }
+};
 
 void Library::loadFromCSV(const std::string& booksFile,
-                          const std::string& transFile)
+                          const std::string& transFile,
+                          const std::string& finesFile,
+                          std::size_t threads)
 {
-    // -------- Load Books --------
+    // Each file is mapped and tokenized in place: fields are string_views
+    // into the mapping and numbers go through from_chars, so a record
+    // costs no per-line strings or streams. Malformed records are reported
+    // with their line number and skipped.
+    //
+    // transactions.csv is cut at line breaks into chunks that the shared
+    // pool parses while this thread loads the books; the chunks are then
+    // appended in file order, so the result matches a sequential load.
+
+    // loadBooks adds to the search indexes, so they must be complete
+    ensureKeywordIndex();
+    ensureTrigramIndex();
+    ensureAutocomplete();
+
+    ThreadPool& pool = ThreadPool::shared();
+    std::size_t parts = threads == 0 ? pool.size() : threads;
+
+    // -------- Start parsing transactions --------
+    // transactionId,userId,bookId,checkout,due,returned,status
+
+    MappedFile intf;
+    std::vector<std::future<TransactionChunk>> pending;
+    PendingChunks waitForPending{pending};  // declared after intf: runs first
+    std::vector<TransactionChunk> chunks;
+
+    if (intf.open(transFile)) {
+        for (std::string_view text : CsvReader::splitLines(intf.text(), parts)) {
+            if (threads == 1)
+                chunks.push_back(parseTransactionChunk(text));  // sequential mode
+            else
+                pending.push_back(pool.submit([text] { return parseTransactionChunk(text); }));
+        }
+    }
 
-    std::ifstream inb(booksFile);
-    if (inb) {
-        std::string line;
+    // -------- Load Books (meanwhile, on this thread) --------
+    // bookId,title,author,isbn,totalCopies,availableCopies
 
-        while (std::getline(inb, line)) {
-            if (line.empty()) continue;
+    MappedFile inb;
+    if (inb.open(booksFile))
+        loadBooks(inb.text(), booksFile);
 
-            std::stringstream ss(line);
-            std::string token;
+    // Next book ID: parallel max over the catalog's ID column
+    for (int id : pool.mapChunks(books.size(), threads,
+                                 [this](std::size_t begin, std::size_t end) {
+                                     return books.maxId(begin, end);
+                                 }))
+        nextBookId = std::max(nextBookId, id + 1);
 
-            int id, total, avail;
-            std::string title, author, isbn;
+    // -------- Merge transactions in file order --------
 
-            std::getline(ss, token, ','); id = std::stoi(token);
-            std::getline(ss, title, ',');
-            std::getline(ss, author, ',');
-            std::getline(ss, isbn, ',');
-            std::getline(ss, token, ','); total = std::stoi(token);
-            std::getline(ss, token, ','); avail = std::stoi(token);
+    for (auto& f : pending)
+        chunks.push_back(f.get());
 
-            Book b(id, title, author, isbn, total, avail);
-            books.push_back(b);
+    std::size_t total = 0;
+    for (const auto& c : chunks)
+        total += c.records.size();
+    transactions.reserve(transactions.size() + total);
 
-            nextBookId = std::max(nextBookId, id + 1);
-        }
+    std::size_t lineOffset = 0;
+    for (auto& chunk : chunks) {
+        for (const auto& err : chunk.errors)
+            recordError(transFile, lineOffset + err.first, err.second);
+        lineOffset += chunk.lines;
+
+        // Next transaction ID: max of the per-chunk maxima
+        nextTransactionId = std::max(nextTransactionId, chunk.maxId + 1);
+
+        for (const Transaction& t : chunk.records)
+            appendLoadedTransaction(t);
+
+        chunk.records = std::vector<Transaction>();  // release as we go
     }
 
-    // -------- Load Transactions --------
+    // -------- Load Fines --------
+    // transactionId,userId,amount,Paid|Unpaid
 
-    std::ifstream intf(transFile);
-    if (intf) {
-        std::string line;
+    MappedFile inf;
+    if (inf.open(finesFile))
+        loadFines(inf.text(), finesFile);
 
-        while (std::getline(intf, line)) {
-            if (line.empty()) continue;
+    recomputeStats();
+}
+
+void Library::loadBooks(std::string_view text, const std::string& file) {
+    std::size_t expected = CsvReader::countLines(text);
+    books.reserve(books.size() + expected);
+    bookIndex.reserve(bookIndex.size() + expected);
+    isbnIndex.reserve(isbnIndex.size() + expected);
 
-            std::stringstream ss(line);
-            std::string token;
+    CsvReader reader(text);
+    std::string_view f[6];
+    std::size_t n;
+    int unindexedIsbns = 0;
+    int sharedIsbns = 0;
 
-            int tid, uid, bid;
-            std::string checkout, due, returned, status;
+    while (reader.next(f, 6, n)) {
+        std::size_t line = reader.lineNumber();
+
+        if (n != 6) {
+            recordError(file, line, "expected 6 fields, found " + std::to_string(n));
+            continue;
+        }
 
-            std::getline(ss, token, ','); tid = std::stoi(token);
-            std::getline(ss, token, ','); uid = std::stoi(token);
-            std::getline(ss, token, ','); bid = std::stoi(token);
-            std::getline(ss, checkout, ',');
-            std::getline(ss, due, ',');
-            std::getline(ss, returned, ',');
-            std::getline(ss, status, ',');
+        int id, total, avail;
+        if (!CsvReader::parseInt(f[0], id) || id < 0) {
+            recordError(file, line, "invalid book ID '" + std::string(f[0]) + "'");
+            continue;
+        }
+        if (!CsvReader::parseInt(f[4], total) || !CsvReader::parseInt(f[5], avail)) {
+            recordError(file, line, "copy counts must be whole numbers");
+            continue;
+        }
 
-            Transaction t(tid, uid, bid, checkout, due, returned, status);
-            transactions.push_back(t);
+        // Same copy rules as Book's constructor
+        try {
+            Book::checkTotalCopies(total, avail);
+            Book::checkAvailableCopies(avail, total);
+        } catch (const std::invalid_argument& e) {
+            recordError(file, line, e.what());
+            continue;
+        }
 
-            nextTransactionId = std::max(nextTransactionId, tid + 1);
+        std::string_view title = f[1], author = f[2], isbn = f[3];
+
+        // Valid ISBNs are stored in 13-digit form; malformed ones (older
+        // files) are kept as text, unindexed
+        std::string isbn13;
+        Isbn::Key key = Isbn::parse(isbn);
+        if (key != Isbn::NONE) {
+            isbn13 = Isbn::toString(key);
+            isbn = isbn13;
+        } else if (!isbn.empty()) {
+            unindexedIsbns++;
+        }
+
+        // ===== EDGE CASE: ISBN already used by an earlier row =====
+        // The row is still loaded (and saved back), but only the first
+        // book keeps the ISBN index entry
+        if (key != Isbn::NONE && isbnIndex.count(key))
+            sharedIsbns++;
+
+        BookHandle h = books.insert(id, title, author, isbn, total, avail);
+
+        // First record wins if the file repeats an ID
+        if (bookIndex.emplace(id, h).second) {
+            if (key != Isbn::NONE)
+                isbnIndex.emplace(key, h);
+            keywordIndex.addBook(id, title, author);
+            trigramIndex.addBook(id, title, author, isbn);
+            autocomplete.addBook(id, title, author);
+        } else {
+            repeatedIds[id].push_back(h);
+        }
+    }
+
+    if (unindexedIsbns > 0)
+        std::cerr << "[WARNING] " << file << ": " << unindexedIsbns
+                  << " book(s) have an invalid ISBN and can't be found by ISBN\n";
+    if (sharedIsbns > 0)
+        std::cerr << "[WARNING] " << file << ": " << sharedIsbns
+                  << " book(s) repeat an earlier book's ISBN and can't be found by ISBN\n";
+}
+
+void Library::appendLoadedTransaction(const Transaction& t) {
+    int tid = t.getTransactionId();
+    transactions.push_back(t);
+    indexTransaction(tid, transactions.size() - 1);
+    if (t.isActive()) {
+        activeLoans[t.getUserId()].push_back(tid);
+        if (t.getDueDay() != Transaction::NO_DATE)
+            dueIndex.emplace(t.getDueDay(), tid);
+    }
+
+    // Every past loan counts toward the book's autocomplete rank
+    if (autocompletePending) return;  // counted when the index is built
+    if (BookRef b = findBookById(t.getBookId()))
+        autocomplete.recordCheckout(t.getBookId(), b->getTitle(), b->getAuthor());
+}
+
+// One streaming pass: each record goes straight into the ledger, which
+// rebuilds the per-user balances and transaction index as it goes
+void Library::loadFines(std::string_view text, const std::string& file) {
+    CsvReader reader(text);
+    std::string_view f[FineLedger::CSV_FIELDS];
+    std::size_t n;
+
+    while (reader.next(f, FineLedger::CSV_FIELDS, n)) {
+        try {
+            if (!fines.addFromCSV(f, n))
+                recordError(file, reader.lineNumber(), "malformed fine record");
+        } catch (const std::invalid_argument& e) {
+            recordError(file, reader.lineNumber(), e.what());
         }
     }
 }
@@ -223,7 +877,8 @@ void Library::loadFromCSV(const std::string& booksFile,
 // ==================== SAVE TO CSV ====================
 
 void Library::saveToCSV(const std::string& booksFile,
-                        const std::string& transFile)
+                        const std::string& transFile,
+                        const std::string& finesFile)
 {
     // Save books
     std::ofstream outb(booksFile);
@@ -236,6 +891,211 @@ void Library::saveToCSV(const std::string& booksFile,
 
     for (const auto& t : transactions)
         outt << t.toCSV() << "\n";
+
+    // Save fines (in charge order)
+    std::ofstream outf(finesFile);
+
+    for (std::size_t i = 0; i < fines.size(); ++i)
+        outf << fines.toCSV(i) << "\n";
+}
+
+// ==================== SNAPSHOT ====================
+
+bool Library::loadSnapshot(const std::string& booksFile,
+                           const std::string& transFile,
+                           const std::string& finesFile,
+                           const std::string& snapFile)
+{
+    // ===== EDGE CASE: Data already loaded =====
+    if (!books.empty() || !transactions.empty() || fines.size() != 0)
+        return false;
+
+    MappedFile file;
+    if (!file.open(snapFile))
+        return false;  // none saved yet
+
+    // Everything is validated before anything is loaded
+    Snapshot::View view;
+    std::string why;
+    if (!Snapshot::open(file.text(), view, why)) {
+        std::cerr << "[WARNING] " << snapFile << ": " << why << ", loading CSV instead\n";
+        return false;
+    }
+    if (view.header->sourceStamp != Snapshot::sourceStamp({booksFile, transFile, finesFile})) {
+        std::cerr << "[WARNING] " << snapFile
+                  << ": CSV files changed since it was saved, loading CSV instead\n";
+        return false;
+    }
+
+    const Snapshot::Header& header = *view.header;
+
+    // -------- Books --------
+    // Records and strings are read straight from the mapping; the text
+    // is copied once, into the catalog. The search indexes wait for the
+    // first search that needs them.
+    keywordIndexPending = trigramIndexPending = autocompletePending = true;
+    books.reserve(header.bookCount);
+    bookIndex.reserve(header.bookCount);
+    isbnIndex.reserve(header.bookCount);
+
+    for (std::uint64_t i = 0; i < header.bookCount; ++i) {
+        const Snapshot::BookRecord& r = view.books[i];
+        std::string_view title = view.title(r), author = view.author(r), isbn = view.isbn(r);
+
+        BookHandle h = books.insert(r.bookId, title, author, isbn,
+                                    r.totalCopies, r.availableCopies);
+
+        // Same rule as loadBooks: the first record of a repeated ID wins
+        if (bookIndex.emplace(r.bookId, h).second) {
+            Isbn::Key key = books.get(h).getIsbnKey();
+            if (key != Isbn::NONE)
+                isbnIndex.emplace(key, h);
+        } else {
+            repeatedIds[r.bookId].push_back(h);
+        }
+    }
+
+    // -------- Transactions --------
+    transactions.reserve(header.transactionCount);
+
+    for (std::uint64_t i = 0; i < header.transactionCount; ++i) {
+        const Snapshot::TransactionRecord& r = view.transactions[i];
+        appendLoadedTransaction(Transaction(r.transactionId, r.userId, r.bookId,
+                                            r.checkoutDay, r.dueDay, r.returnDay,
+                                            static_cast<Transaction::Status>(r.status)));
+    }
+
+    // -------- Fines --------
+    for (std::uint64_t i = 0; i < header.fineCount; ++i) {
+        const Snapshot::FineRecord& r = view.fines[i];
+        Fine fine(r.userId, r.transactionId, Money::fromCents(r.cents));
+        if (r.paid) fines.chargePaid(fine);
+        else fines.charge(fine);
+    }
+
+    nextBookId = std::max(nextBookId, static_cast<int>(header.nextBookId));
+    nextTransactionId = std::max(nextTransactionId, static_cast<int>(header.nextTransactionId));
+
+    recomputeStats();
+    return true;
+}
+
+std::vector<std::size_t> Library::indexedPositions() const {
+    std::vector<std::size_t> positions;
+    positions.reserve(bookIndex.size());
+    for (const auto& entry : bookIndex)
+        positions.push_back(books.positionOf(entry.second));
+    std::sort(positions.begin(), positions.end());
+    return positions;
+}
+
+void Library::ensureKeywordIndex() {
+    if (!keywordIndexPending) return;
+    keywordIndexPending = false;
+
+    for (std::size_t pos : indexedPositions()) {
+        BookRef b = books[pos];
+        keywordIndex.addBook(b.getBookId(), b.getTitle(), b.getAuthor());
+    }
+}
+
+void Library::ensureTrigramIndex() {
+    if (!trigramIndexPending) return;
+    trigramIndexPending = false;
+
+    for (std::size_t pos : indexedPositions()) {
+        BookRef b = books[pos];
+        trigramIndex.addBook(b.getBookId(), b.getTitle(), b.getAuthor(), b.getIsbn());
+    }
+}
+
+void Library::ensureAutocomplete() {
+    if (!autocompletePending) return;
+    autocompletePending = false;
+
+    for (std::size_t pos : indexedPositions()) {
+        BookRef b = books[pos];
+        autocomplete.addBook(b.getBookId(), b.getTitle(), b.getAuthor());
+    }
+
+    // Circulation ranks, as appendLoadedTransaction counts them
+    for (const Transaction& t : transactions) {
+        if (BookRef b = findBookById(t.getBookId()))
+            autocomplete.recordCheckout(t.getBookId(), b->getTitle(), b->getAuthor());
+    }
+}
+
+bool Library::saveSnapshot(const std::string& booksFile,
+                           const std::string& transFile,
+                           const std::string& finesFile,
+                           const std::string& snapFile) const
+{
+    Snapshot::Contents contents;
+    contents.nextBookId = nextBookId;
+    contents.nextTransactionId = nextTransactionId;
+    contents.sourceStamp = Snapshot::sourceStamp({booksFile, transFile, finesFile});
+
+    // Books, in catalog order
+    contents.books.reserve(books.size());
+    for (const auto& b : books)
+        contents.addBook(b.getBookId(), b.getTitle(), b.getAuthor(), b.getIsbn(),
+                         b.getTotalCopies(), b.getAvailableCopies());
+
+    // Transactions, in the same order as transactions.csv
+    contents.transactions.reserve(transactions.size());
+    for (const Transaction& t : transactions) {
+        Snapshot::TransactionRecord r{};
+        r.transactionId = t.getTransactionId();
+        r.userId = t.getUserId();
+        r.bookId = t.getBookId();
+        r.checkoutDay = t.getCheckoutDay();
+        r.dueDay = t.getDueDay();
+        r.returnDay = t.getReturnDay();
+        r.status = static_cast<std::uint8_t>(t.getStatusCode());
+        contents.transactions.push_back(r);
+    }
+
+    // Fines, in charge order
+    contents.fines.reserve(fines.size());
+    for (std::size_t i = 0; i < fines.size(); ++i) {
+        Fine fine = fines[i];
+        Snapshot::FineRecord r{};
+        r.cents = fine.getAmount().cents();
+        r.transactionId = fine.getTransactionId();
+        r.userId = fine.getUserId();
+        r.paid = fines.isPaid(i) ? 1 : 0;
+        contents.fines.push_back(r);
+    }
+
+    return Snapshot::write(snapFile, contents);
+}
+
+void Library::load(const std::string& booksFile,
+                   const std::string& transFile,
+                   const std::string& finesFile,
+                   const std::string& snapFile)
+{
+    bool empty = books.empty() && transactions.empty() && fines.size() == 0;
+    if (empty && loadSnapshot(booksFile, transFile, finesFile, snapFile))
+        return;
+
+    loadFromCSV(booksFile, transFile, finesFile);
+
+    // The CSV files are unchanged, so this snapshot serves the next start
+    // (not after merging into existing data: it wouldn't match the files)
+    if (empty && !saveSnapshot(booksFile, transFile, finesFile, snapFile))
+        std::cerr << "[WARNING] " << snapFile << ": could not write snapshot\n";
+}
+
+void Library::save(const std::string& booksFile,
+                   const std::string& transFile,
+                   const std::string& finesFile,
+                   const std::string& snapFile)
+{
+    saveToCSV(booksFile, transFile, finesFile);
+
+    if (!saveSnapshot(booksFile, transFile, finesFile, snapFile))
+        std::cerr << "[WARNING] " << snapFile << ": could not write snapshot\n";
 }
 
 // ==================== ACCESSORS ====================
@@ -244,7 +1104,60 @@ std::vector<Transaction>& Library::getTransactions() {
     return transactions;
 }
 
-std::vector<Fine>& Library::getFines() {
+const FineLedger& Library::getFines() const {
     return fines;
 }
+
+Money Library::outstandingFines(int userId) const {
+    return fines.outstanding(userId);
+}
+
+bool Library::payFine(int transactionId) {
+    return fines.settle(transactionId);
+}
+
+// ==================== REPORT TOTALS ====================
+
+void Library::recomputeStats() {
+    InventoryTotals inventory = inventoryTotals();
+    TransactionTotals loans = transactionTotals();
+
+    statsCache = LibraryStats{};
+    statsCache.titles = inventory.titles;
+    statsCache.totalCopies = inventory.totalCopies;
+    statsCache.availableCopies = inventory.availableCopies;
+    statsCache.activeLoans = loans.active;
+    statsCache.returned = loans.returned;
+    statsCache.lateReturns = loans.late;
+    statsCache.daysLate = loans.daysLate;
+
+    statsCache.fineCount = static_cast<int>(fines.size());
+    statsCache.fineTotal = fines.total();
+}
+
+InventoryTotals Library::inventoryTotals() const {
+    // Column sums: only the two count arrays are touched
+    InventoryTotals t;
+    t.titles = static_cast<int>(books.size());
+    t.totalCopies = books.sumTotalCopies(0, books.size());
+    t.availableCopies = books.sumAvailableCopies(0, books.size());
+    return t;
+}
+
+TransactionTotals Library::transactionTotals() const {
+    TransactionTotals t;
+    for (const Transaction& tr : transactions) {
+        if (tr.isActive()) t.active++;
+        else if (tr.isLate()) t.late++;
+        else t.returned++;
+    }
+
+    // Lateness of every loan in one batch pass
+    std::vector<std::int32_t> late(transactions.size());
+    Transaction::calculateDaysLate(transactions.data(), transactions.size(),
+                                   late.data());
+    for (std::int32_t d : late)
+        t.daysLate += d;
+    return t;
+}
             //Emma Das
@@ -0,0 +1,119 @@
+/*
+ MappedFile.cpp
+ Implementation file for the MappedFile class (read-only file mapping).
+*/
+
+#include "MappedFile.h"
+#include <utility>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : bytes(std::exchange(other.bytes, nullptr)),
+      length(std::exchange(other.length, 0)),
+      opened(std::exchange(other.opened, false))
+{}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        unmap();
+        bytes = std::exchange(other.bytes, nullptr);
+        length = std::exchange(other.length, 0);
+        opened = std::exchange(other.opened, false);
+    }
+    return *this;
+}
+
+#if defined(_WIN32)
+
+bool MappedFile::open(const std::string& path) {
+    unmap();
+
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize)) {
+        CloseHandle(file);
+        return false;
+    }
+
+    // ===== EDGE CASE: Empty file (can't map zero bytes) =====
+    if (fileSize.QuadPart == 0) {
+        CloseHandle(file);
+        opened = true;
+        return true;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);  // the mapping keeps the file open
+    if (!mapping) return false;
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);  // the view keeps the mapping alive
+    if (!view) return false;
+
+    bytes = static_cast<const char*>(view);
+    length = static_cast<std::size_t>(fileSize.QuadPart);
+    opened = true;
+    return true;
+}
+
+void MappedFile::unmap() {
+    if (bytes) UnmapViewOfFile(bytes);
+    bytes = nullptr;
+    length = 0;
+    opened = false;
+}
+
+#else
+
+bool MappedFile::open(const std::string& path) {
+    unmap();
+
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat info;
+    if (::fstat(fd, &info) != 0) {
+        ::close(fd);
+        return false;
+    }
+
+    // ===== EDGE CASE: Empty file (can't map zero bytes) =====
+    if (info.st_size == 0) {
+        ::close(fd);
+        opened = true;
+        return true;
+    }
+
+    void* view = ::mmap(nullptr, static_cast<std::size_t>(info.st_size),
+                        PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);  // the mapping keeps the file open
+    if (view == MAP_FAILED) return false;
+
+    // The loader reads front to back exactly once
+    ::madvise(view, static_cast<std::size_t>(info.st_size), MADV_SEQUENTIAL);
+
+    bytes = static_cast<const char*>(view);
+    length = static_cast<std::size_t>(info.st_size);
+    opened = true;
+    return true;
+}
+
+void MappedFile::unmap() {
+    if (bytes) ::munmap(const_cast<char*>(bytes), length);
+    bytes = nullptr;
+    length = 0;
+    opened = false;
+}
+
+#endif
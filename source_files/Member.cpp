@@ -2,6 +2,7 @@
 #include "Library.h"
 #include <iostream>
 #include <limits>
+#include <algorithm>
 
 // Constructor
 Member::Member(int id, const std::string& name, const std::string& email,
@@ -66,9 +67,11 @@ void Member::returnBook() {
     std::cin >> returnDate;
 
     try {
-        Fine fine = Library::instance().processReturn(transId, returnDate);
+        ReturnResult result = Library::instance().processReturn(transId, returnDate);
         std::cout << "Book returned successfully.\n";
-        std::cout << "Fine amount: $" << fine.getAmount() << "\n";
+        std::cout << "Fine amount: $" << result.fine.getAmount() << "\n";
+        std::cout << "Outstanding balance: $"
+                  << Library::instance().outstandingFines(result.transaction.getUserId()) << "\n";
     } catch (const std::exception& e) {
         std::cout << "Error: " << e.what() << "\n";
     }
@@ -78,25 +81,21 @@ void Member::returnBook() {
 // View All Borrowed Books
 // -------------------------------
 void Member::viewMyBorrowedBooks() const {
-    auto& trans = Library::instance().getTransactions();
-    bool found = false;
+    // Only this member's active loans, straight from the Library index
+    auto loans = Library::instance().getActiveLoans(userID);
 
     std::cout << "\n=== My Borrowed Books ===\n";
 
-    for (const auto& t : trans) {
-        if (t.getUserId() == userID && t.isActive()) {
-            found = true;
-
-            Book* b = Library::instance().findBookById(t.getBookId());
-            if (b) {
-                std::cout << "Transaction ID: " << t.getTransactionId()
-                          << " | Book: " << b->getTitle()
-                          << " | Due: " << t.getDueDate() << "\n";
-            }
+    for (const Transaction* t : loans) {
+        BookRef b = Library::instance().findBookById(t->getBookId());
+        if (b) {
+            std::cout << "Transaction ID: " << t->getTransactionId()
+                      << " | Book: " << b->getTitle()
+                      << " | Due: " << t->getDueDate() << "\n";
         }
     }
 
-    if (!found)
+    if (loans.empty())
         std::cout << "You have no borrowed books.\n";
 }
 
@@ -123,26 +122,59 @@ void Member::menu() {
 
         switch (opt) {
             case 1: {
-                std::cout << "Enter keyword (title/author/ISBN): ";
+                std::cout << "Enter keyword (title/author/ISBN, end with * for suggestions): ";
                 std::string kw;
                 std::getline(std::cin >> std::ws, kw);
 
-                auto results = Library::instance().searchBooks([&](const Book& b) {
-                    return b.getTitle().find(kw) != std::string::npos
-                        || b.getAuthor().find(kw) != std::string::npos
-                        || b.getIsbn().find(kw) != std::string::npos;
-                });
+                // "Cle*" lists the most borrowed titles/authors starting with "Cle"
+                if (!kw.empty() && kw.back() == '*') {
+                    auto suggestions = Library::instance().suggest(kw.substr(0, kw.size() - 1));
+                    if (suggestions.empty())
+                        std::cout << "No suggestions.\n";
+                    else
+                        for (const auto& s : suggestions)
+                            std::cout << "  " << s << "\n";
+                    break;
+                }
+
+                // Results are paged so broad keywords don't list the whole catalog
+                BookCursor cursor = Library::instance().searchSubstringCursor(kw);
+                auto results = cursor.nextPage();
 
-                if (results.empty())
+                if (results.empty()) {
                     std::cout << "No matches found.\n";
+
+                    // Typo tolerance: about one edit per 4 characters, max 3
+                    int maxEdits = std::max(1, std::min(3, static_cast<int>(kw.size()) / 4));
+                    auto close = Library::instance().fuzzySearch(kw, maxEdits);
+                    if (!close.empty()) {
+                        std::cout << "Did you mean:\n";
+                        for (const auto& m : close)
+                            std::cout << m.book->getBookId() << ": "
+                                      << m.book->getTitle() << " | "
+                                      << m.book->getAuthor() << "\n";
+                    }
+                }
                 else
-                    for (auto p : results)
-                        std::cout << p->getBookId() << ": "
-                                  << p->getTitle() << " | "
-                                  << p->getAuthor()
-                                  << " | avail: "
-                                  << p->getAvailableCopies()
-                                  << "\n";
+                    while (true) {
+                        for (auto p : results)
+                            std::cout << p->getBookId() << ": "
+                                      << p->getTitle() << " | "
+                                      << p->getAuthor()
+                                      << " | avail: "
+                                      << p->getAvailableCopies()
+                                      << "\n";
+
+                        if (!cursor.hasMore()) break;
+
+                        // Whole line, so "yes" leaves nothing behind for the menu
+                        std::cout << "Show more results? (y/n): ";
+                        std::string more;
+                        if (!std::getline(std::cin >> std::ws, more)
+                            || (more[0] != 'y' && more[0] != 'Y')) break;
+
+                        results = cursor.nextPage();
+                    }
                 break;
             }
 
@@ -0,0 +1,58 @@
+/*
+ Money.cpp
+ Implementation file for the Money class (conversions to and from text).
+*/
+
+#include "Money.h"
+#include <cmath>
+
+Money Money::fromDollars(double dollars) {
+    return Money(static_cast<std::int64_t>(std::llround(dollars * 100.0)));
+}
+
+bool Money::parse(std::string_view s, Money& out) {
+    std::size_t i = 0;
+    bool negative = false;
+    if (i < s.size() && s[i] == '-') {
+        negative = true;
+        ++i;
+    }
+
+    // Whole dollars (at least one digit)
+    std::size_t start = i;
+    std::int64_t value = 0;
+    while (i < s.size() && s[i] >= '0' && s[i] <= '9' && i - start < 15)
+        value = value * 10 + (s[i++] - '0');
+    if (i == start) return false;
+    value *= 100;
+
+    // Optional cents: one or two digits after the point
+    if (i < s.size() && s[i] == '.') {
+        ++i;
+        if (i < s.size() && s[i] >= '0' && s[i] <= '9') value += (s[i++] - '0') * 10;
+        else return false;
+        if (i < s.size() && s[i] >= '0' && s[i] <= '9') value += s[i++] - '0';
+    }
+
+    if (i != s.size()) return false;
+
+    out = Money(negative ? -value : value);
+    return true;
+}
+
+std::string Money::toString() const {
+    std::int64_t a = amountCents < 0 ? -amountCents : amountCents;
+    std::string digits = std::to_string(a / 100);
+    std::int64_t c = a % 100;
+
+    std::string s = amountCents < 0 ? "-" : "";
+    s += digits;
+    s += '.';
+    s += static_cast<char>('0' + c / 10);
+    s += static_cast<char>('0' + c % 10);
+    return s;
+}
+
+std::ostream& operator<<(std::ostream& os, Money m) {
+    return os << m.toString();
+}
@@ -2,6 +2,7 @@
 #include "Library.h"
 #include <iostream>
 #include <limits>
+#include <algorithm>
 
 // Constructor: initialize NonMember with basic user info and associated Library
 NonMember::NonMember(int id, const std::string& name, const std::string& email,
@@ -33,24 +34,56 @@ void NonMember::menu() {
 
         if (opt == 1) {
             // Search books by keyword in title, author, or ISBN
-            std::cout << "Enter keyword (title/author/ISBN): ";
+            std::cout << "Enter keyword (title/author/ISBN, end with * for suggestions): ";
             std::string kw;
             std::getline(std::cin >> std::ws, kw); // ws consumes leading whitespace
 
-            // Use getter methods to access private Book members (encapsulation)
-            auto results = Library::instance().searchBooks([&](const Book& b) {
-                return b.getTitle().find(kw) != std::string::npos
-                       || b.getAuthor().find(kw) != std::string::npos
-                       || b.getIsbn().find(kw) != std::string::npos;
-            });
+            // "Cle*" lists the most borrowed titles/authors starting with "Cle"
+            if (!kw.empty() && kw.back() == '*') {
+                auto suggestions = Library::instance().suggest(kw.substr(0, kw.size() - 1));
+                if (suggestions.empty())
+                    std::cout << "No suggestions.\n";
+                else
+                    for (const auto& s : suggestions)
+                        std::cout << "  " << s << "\n";
+                continue;
+            }
+
+            // Substring match on title/author/ISBN, served by the trigram index
+            // and paged so broad keywords don't list the whole catalog
+            BookCursor cursor = Library::instance().searchSubstringCursor(kw);
+            auto results = cursor.nextPage();
 
-            if (results.empty())
+            if (results.empty()) {
                 std::cout << "No matches found.\n";
+
+                // Typo tolerance: about one edit per 4 characters, max 3
+                int maxEdits = std::max(1, std::min(3, static_cast<int>(kw.size()) / 4));
+                auto close = Library::instance().fuzzySearch(kw, maxEdits);
+                if (!close.empty()) {
+                    std::cout << "Did you mean:\n";
+                    for (const auto& m : close)
+                        std::cout << m.book->getBookId() << ": " << m.book->getTitle()
+                             << " | " << m.book->getAuthor() << "\n";
+                }
+            }
             else
-                // Access Book data through public getters
-                for (auto p : results)
-                    std::cout << p->getBookId() << ": " << p->getTitle() << " | " << p->getAuthor()
-                         << " | avail: " << p->getAvailableCopies() << "\n";
+                while (true) {
+                    // Access Book data through public getters
+                    for (auto p : results)
+                        std::cout << p->getBookId() << ": " << p->getTitle() << " | " << p->getAuthor()
+                             << " | avail: " << p->getAvailableCopies() << "\n";
+
+                    if (!cursor.hasMore()) break;
+
+                    // Whole line, so "yes" leaves nothing behind for the menu
+                    std::cout << "Show more results? (y/n): ";
+                    std::string more;
+                    if (!std::getline(std::cin >> std::ws, more)
+                        || (more[0] != 'y' && more[0] != 'Y')) break;
+
+                    results = cursor.nextPage();
+                }
 
         } else if (opt == 2) {
             // View all books in the library using public getters
@@ -0,0 +1,33 @@
+/*
+ SimdScan.cpp
+ Implementation file for the SimdScan class (CPU kernel selection).
+*/
+
+#include "SimdScan.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SIMDSCAN_X86 1
+#endif
+
+// ==================== DISPATCH ====================
+
+SimdScan::Kernel SimdScan::activeKernel() {
+    static const Kernel kernel = [] {
+#ifdef SIMDSCAN_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) return Kernel::AVX2;
+        if (__builtin_cpu_supports("sse2")) return Kernel::SSE2;
+#endif
+        return Kernel::Scalar;
+    }();
+    return kernel;
+}
+
+const char* SimdScan::kernelName() {
+    switch (activeKernel()) {
+        case Kernel::AVX2: return "AVX2";
+        case Kernel::SSE2: return "SSE2";
+        case Kernel::Scalar: break;
+    }
+    return "Scalar";
+}
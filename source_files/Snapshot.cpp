@@ -0,0 +1,253 @@
+/*
+ Snapshot.cpp
+ Implementation file for the Snapshot class (library.snap layout,
+ validation, checksum and atomic writing).
+*/
+
+#include "Snapshot.h"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+// ==================== LAYOUT ====================
+
+static std::uint64_t align8(std::uint64_t n) {
+    return (n + 7) & ~std::uint64_t{7};
+}
+
+// Byte offsets of the sections that follow the header
+struct SectionOffsets {
+    std::uint64_t books;
+    std::uint64_t transactions;
+    std::uint64_t fines;
+    std::uint64_t strings;
+    std::uint64_t end;
+};
+
+static SectionOffsets layout(std::uint64_t bookCount, std::uint64_t transactionCount,
+                             std::uint64_t fineCount, std::uint64_t stringBytes)
+{
+    SectionOffsets at;
+    at.books = align8(sizeof(Snapshot::Header));
+    at.transactions = align8(at.books + bookCount * sizeof(Snapshot::BookRecord));
+    at.fines = align8(at.transactions + transactionCount * sizeof(Snapshot::TransactionRecord));
+    at.strings = align8(at.fines + fineCount * sizeof(Snapshot::FineRecord));
+    at.end = at.strings + stringBytes;
+    return at;
+}
+
+// ==================== CHECKSUM ====================
+
+static std::uint64_t rotl(std::uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+static constexpr std::uint64_t PRIME1 = 0x9E3779B185EBCA87ULL;
+static constexpr std::uint64_t PRIME2 = 0xC2B2AE3D27D4EB4FULL;
+
+static std::uint64_t mixWord(std::uint64_t lane, std::uint64_t word) {
+    return rotl(lane + word * PRIME2, 31) * PRIME1;
+}
+
+std::uint64_t Snapshot::checksum(const char* data, std::size_t size) {
+    // Four lanes over consecutive 8-byte words keep four multiplies in
+    // flight instead of one long dependency chain
+    std::uint64_t lanes[4] = {PRIME1 + PRIME2, PRIME2, 0, 0 - PRIME1};
+
+    std::size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        for (int k = 0; k < 4; ++k) {
+            std::uint64_t word;
+            std::memcpy(&word, data + i + 8 * k, 8);
+            lanes[k] = mixWord(lanes[k], word);
+        }
+    }
+
+    std::uint64_t h = rotl(lanes[0], 1) + rotl(lanes[1], 7)
+                    + rotl(lanes[2], 12) + rotl(lanes[3], 18);
+    h += static_cast<std::uint64_t>(size);
+
+    // ===== EDGE CASE: Tail shorter than a full round =====
+    for (; i < size; i += 8) {
+        std::uint64_t word = 0;
+        std::memcpy(&word, data + i, std::min<std::size_t>(8, size - i));
+        h = mixWord(h, word);
+    }
+
+    // Final avalanche so every input bit reaches every output bit
+    h ^= h >> 33;
+    h *= PRIME2;
+    h ^= h >> 29;
+    h *= PRIME1;
+    h ^= h >> 32;
+    return h;
+}
+
+std::uint64_t Snapshot::sourceStamp(const std::vector<std::string>& files) {
+    std::vector<std::int64_t> facts;
+
+    for (const std::string& file : files) {
+        std::error_code ec;
+        auto size = std::filesystem::file_size(file, ec);
+        facts.push_back(ec ? -1 : static_cast<std::int64_t>(size));
+
+        auto modified = std::filesystem::last_write_time(file, ec);
+        facts.push_back(ec ? 0 : static_cast<std::int64_t>(modified.time_since_epoch().count()));
+    }
+
+    return checksum(reinterpret_cast<const char*>(facts.data()),
+                    facts.size() * sizeof(std::int64_t));
+}
+
+// ==================== READING ====================
+
+bool Snapshot::open(std::string_view bytes, View& view, std::string& why) {
+    if (bytes.size() < sizeof(Header)) {
+        why = "file is too small to be a snapshot";
+        return false;
+    }
+    if (reinterpret_cast<std::uintptr_t>(bytes.data()) % 8 != 0) {
+        why = "snapshot bytes are not 8-byte aligned";
+        return false;
+    }
+
+    const Header* header = reinterpret_cast<const Header*>(bytes.data());
+
+    if (std::memcmp(header->magic, MAGIC, sizeof(MAGIC)) != 0) {
+        why = "not a library snapshot";
+        return false;
+    }
+    if (header->byteOrder != ENDIAN_MARK) {
+        why = "snapshot was written on a machine with another byte order";
+        return false;
+    }
+    if (header->version != VERSION) {
+        why = "snapshot version " + std::to_string(header->version)
+            + ", expected " + std::to_string(VERSION);
+        return false;
+    }
+
+    // ===== EDGE CASE: Truncated file, or counts too large to be real =====
+    // (checked against the size first so the layout sums can't overflow)
+    const std::uint64_t size = bytes.size();
+    if (header->fileSize != size || header->bookCount > size
+        || header->transactionCount > size || header->fineCount > size
+        || header->stringBytes > size) {
+        why = "snapshot is truncated or its header is damaged";
+        return false;
+    }
+
+    SectionOffsets at = layout(header->bookCount, header->transactionCount,
+                               header->fineCount, header->stringBytes);
+    if (at.end != size) {
+        why = "snapshot section sizes don't add up";
+        return false;
+    }
+
+    if (checksum(bytes.data() + sizeof(Header), size - sizeof(Header)) != header->checksum) {
+        why = "snapshot checksum mismatch";
+        return false;
+    }
+
+    View v;
+    v.header = header;
+    v.books = reinterpret_cast<const BookRecord*>(bytes.data() + at.books);
+    v.transactions = reinterpret_cast<const TransactionRecord*>(bytes.data() + at.transactions);
+    v.fines = reinterpret_cast<const FineRecord*>(bytes.data() + at.fines);
+    v.strings = bytes.substr(at.strings, header->stringBytes);
+
+    // Every view handed out later must lie inside the string heap
+    for (std::uint64_t i = 0; i < header->bookCount; ++i) {
+        const BookRecord& b = v.books[i];
+        std::uint64_t length = std::uint64_t{b.titleLength} + b.authorLength + b.isbnLength;
+        if (b.textOffset > header->stringBytes || length > header->stringBytes - b.textOffset) {
+            why = "book record " + std::to_string(i) + " points outside the string heap";
+            return false;
+        }
+    }
+
+    // Status codes of Transaction::Status (Active, Returned, ReturnedLate)
+    for (std::uint64_t i = 0; i < header->transactionCount; ++i) {
+        if (v.transactions[i].status > 2) {
+            why = "transaction record " + std::to_string(i) + " has an unknown status";
+            return false;
+        }
+    }
+
+    view = v;
+    return true;
+}
+
+// ==================== WRITING ====================
+
+void Snapshot::Contents::addBook(std::int32_t id, std::string_view title, std::string_view author,
+                                 std::string_view isbn, std::int32_t total, std::int32_t available)
+{
+    BookRecord b{};
+    b.bookId = id;
+    b.totalCopies = total;
+    b.availableCopies = available;
+    b.titleLength = static_cast<std::uint32_t>(title.size());
+    b.authorLength = static_cast<std::uint32_t>(author.size());
+    b.isbnLength = static_cast<std::uint32_t>(isbn.size());
+    b.textOffset = strings.size();
+
+    strings.append(title);
+    strings.append(author);
+    strings.append(isbn);
+    books.push_back(b);
+}
+
+bool Snapshot::write(const std::string& path, const Contents& contents) {
+    SectionOffsets at = layout(contents.books.size(), contents.transactions.size(),
+                               contents.fines.size(), contents.strings.size());
+
+    // The whole file is assembled in memory (padding stays zero) and
+    // written with one call
+    std::string out(at.end, '\0');
+    auto copy = [&out](std::uint64_t offset, const void* src, std::size_t n) {
+        if (n > 0) std::memcpy(&out[offset], src, n);
+    };
+    copy(at.books, contents.books.data(), contents.books.size() * sizeof(BookRecord));
+    copy(at.transactions, contents.transactions.data(),
+         contents.transactions.size() * sizeof(TransactionRecord));
+    copy(at.fines, contents.fines.data(), contents.fines.size() * sizeof(FineRecord));
+    copy(at.strings, contents.strings.data(), contents.strings.size());
+
+    Header header{};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.byteOrder = ENDIAN_MARK;
+    header.fileSize = at.end;
+    header.sourceStamp = contents.sourceStamp;
+    header.nextBookId = contents.nextBookId;
+    header.nextTransactionId = contents.nextTransactionId;
+    header.bookCount = contents.books.size();
+    header.transactionCount = contents.transactions.size();
+    header.fineCount = contents.fines.size();
+    header.stringBytes = contents.strings.size();
+    header.checksum = checksum(out.data() + sizeof(Header), out.size() - sizeof(Header));
+    copy(0, &header, sizeof(Header));
+
+    const std::string temp = path + ".tmp";
+    {
+        std::ofstream file(temp, std::ios::binary | std::ios::trunc);
+        file.write(out.data(), static_cast<std::streamsize>(out.size()));
+        file.close();
+        if (!file) {
+            std::error_code ignored;
+            std::filesystem::remove(temp, ignored);
+            return false;
+        }
+    }
+
+    // Replaces any older snapshot in one step
+    std::error_code ec;
+    std::filesystem::rename(temp, path, ec);
+    if (ec) {
+        std::filesystem::remove(temp, ec);
+        return false;
+    }
+    return true;
+}
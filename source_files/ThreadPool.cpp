@@ -0,0 +1,72 @@
+/*
+ ThreadPool.cpp
+ Implementation file for the ThreadPool class (fixed worker threads).
+*/
+
+#include "ThreadPool.h"
+#include <algorithm>
+
+// ==================== CONSTRUCTOR / DESTRUCTOR ====================
+
+ThreadPool::ThreadPool(std::size_t threads) {
+    threads = std::max<std::size_t>(1, threads);
+    for (std::size_t i = 0; i < threads; ++i)
+        workers.emplace_back([this] { workerLoop(); });
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stopping = true;
+    }
+    wake.notify_all();
+
+    for (auto& w : workers)
+        w.join();
+}
+
+ThreadPool& ThreadPool::shared() {
+    // hardware_concurrency() may report 0 when unknown
+    static ThreadPool pool(std::max(1u, std::thread::hardware_concurrency()));
+    return pool;
+}
+
+// ==================== WORKERS ====================
+
+void ThreadPool::workerLoop() {
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> guard(lock);
+            wake.wait(guard, [this] { return stopping || !tasks.empty(); });
+
+            // Drain the queue before shutting down
+            if (tasks.empty()) return;
+
+            task = std::move(tasks.front());
+            tasks.pop();
+        }
+        task();
+    }
+}
+
+// ==================== RANGE SPLITTING ====================
+
+std::vector<std::pair<std::size_t, std::size_t>>
+ThreadPool::splitRange(std::size_t n, std::size_t parts)
+{
+    std::vector<std::pair<std::size_t, std::size_t>> ranges;
+    if (n == 0) return ranges;
+
+    // Never hand a worker fewer than MIN_CHUNK items
+    std::size_t maxParts = (n + MIN_CHUNK - 1) / MIN_CHUNK;
+    parts = std::max<std::size_t>(1, std::min(parts, maxParts));
+
+    std::size_t base = n / parts, extra = n % parts, begin = 0;
+    for (std::size_t i = 0; i < parts; ++i) {
+        std::size_t len = base + (i < extra ? 1 : 0);
+        ranges.emplace_back(begin, begin + len);
+        begin += len;
+    }
+    return ranges;
+}
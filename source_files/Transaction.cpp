@@ -10,86 +10,66 @@
  */
 
 #include "Transaction.h"
+#include "Date.h"
+#include <algorithm>
 #include <iostream>
-#include <sstream>
 #include <stdexcept>
 
 // ==================== PRIVATE HELPER METHODS ====================
 
 /**
- * parseDateToComponents - Parses a date string into numeric components
- * @param dateStr  - Input date string
- * @return true if parsing successful, false if format invalid
+ * parseDay - Parses a date string into a day number
+ * @param dateStr - Input date string ("YYYY-MM-DD", month/day may be 1 digit)
+ * @param field   - Field name used in the error message
+ * @return Days since 1970-01-01, or NO_DATE for an empty string
  *
  * Edge Cases Handled:
- * 1. Empty string -> returns false
- * 2. Wrong format (missing dashes) -> returns false
- * 3. Non-numeric values -> may cause parsing issues
+ * 1. Empty string -> NO_DATE (no date set)
+ * 2. Wrong format (missing dashes, extra text) -> throws invalid_argument
+ * 3. Month outside 1-12 or day past the end of the month -> throws
  */
-bool Transaction::parseDateToComponents(const std::string &dateStr,
-                                        int &year, int &month, int &day)
+std::int32_t Transaction::parseDay(const std::string& dateStr, const char* field)
 {
     // ===== EDGE CASE: Empty date string =====
-    if (dateStr.length() < 10) return false;
+    if (dateStr.empty()) return NO_DATE;
 
-    // ===== EDGE CASE: Invalid length =====
-    // "YYYY-MM-DD" should be exactly 10 characters
-    if (dateStr.length() < 10)
-    {
-        return false;
-    }
-
-    // ===== EDGE CASE: Missing dashes =====
-    // Check for dashes at positions 4 and 7
-    if (dateStr[4] != '-' || dateStr[7] != '-') return false;
-
-    // Use stringstream for parsing
-    // stringstream allows us to parse formatted input easily
-    std::stringstream ss(dateStr);
-    char dash1, dash2; // To capture the dash characters
-
-    // Parse format: YYYY-MM-DD
-    // ss >> year reads until non-numeric character
-    // ss >> dash1 reads the dash
-    // Continue for month and day
-    ss >> year >> dash1 >> month >> dash2 >> day;
-
-    // ===== EDGE CASE: Parsing failure =====
-    // Check if stringstream encountered errors
-    if (ss.fail()) return false;
+    // ===== EDGE CASE: Bad format, month or day range =====
+    Date date;
+    if (!Date::parse(dateStr, date))
+        throw std::invalid_argument(std::string("Invalid ") + field
+            + " (expected YYYY-MM-DD): " + dateStr);
 
-    // ===== EDGE CASE: Invalid month range =====
-    if (month < 1 || month > 12) return false;
-    // ===== EDGE CASE: Invalid day range =====
-    if (day < 1 || day > 31) return false;
-
-    return true; // Parsing successful
+    return date.dayNumber();
 }
 
 /**
- * dateToDays - Converts a date to approximate total days since year 0
- *
- * Purpose: Allows comparing two dates by converting to a single number
- * Note: This is a SIMPLIFIED calculation for educational purposes
- *       It doesn't perfectly handle leap years or varying month lengths
- *       But it's accurate enough for calculating rental period differences
- *
- * @param year  - Year
- * @param month - Month
- * @param day   - Day
- * @return Approximate total days since year 0
- *
- * Formula: year * 365 + month * 30 + day
- * This gives us a comparable number for date differences
- *
- * Example:
- *   dateToDays(2024, 11, 15) = 2024*365 + 11*30 + 15 = 739095
- *   dateToDays(2024, 11, 20) = 2024*365 + 11*30 + 20 = 739100
- *   Difference = 5 days (correct!)
+ * formatDay - Converts a day number back to "YYYY-MM-DD"
+ * Used by the date getters (display and CSV)
  */
-int Transaction::dateToDays(int year, int month, int day)
+std::string Transaction::formatDay(std::int32_t day)
 {
-    return year * 365 + month * 30 + day;
+    if (day == NO_DATE) return "";
+    return Date(day).toString();
+}
+
+// Status text -> enum; ok is false for unknown text
+Transaction::Status Transaction::parseStatus(std::string_view s, bool& ok)
+{
+    ok = true;
+    if (s == "Active") return Status::Active;
+    if (s == "Returned") return Status::Returned;
+    if (s == "Returned-Late") return Status::ReturnedLate;
+    ok = false;
+    return Status::Active;
+}
+
+std::string Transaction::getStatus() const
+{
+    switch (status) {
+        case Status::Returned:     return "Returned";
+        case Status::ReturnedLate: return "Returned-Late";
+        default:                   return "Active";
+    }
 }
 
 // ==================== CONSTRUCTORS ====================
@@ -98,8 +78,8 @@ int Transaction::dateToDays(int year, int month, int day)
 
 Transaction::Transaction()
     : transactionId(0), userId(0), bookId(0),
-      checkoutDate(""), dueDate(""), returnDate(""),
-      status("Active")
+      checkoutDay(NO_DATE), dueDay(NO_DATE), returnDay(NO_DATE),
+      status(Status::Active)
 {
 }
 
@@ -119,9 +99,8 @@ Transaction::Transaction()
 Transaction::Transaction(int tid, int uid, int bid,
                          std::string checkout, std::string due)
     : transactionId(tid), userId(uid), bookId(bid),
-      checkoutDate(std::move(checkout)),
-      dueDate(std::move(due)), returnDate(""),
-      status("Active")
+      checkoutDay(NO_DATE), dueDay(NO_DATE), returnDay(NO_DATE),
+      status(Status::Active)
 {
     // ===== EDGE CASE: Empty Transaction ID =====
     if (tid <= 0) throw std::invalid_argument("Transaction ID must be > 0");
@@ -133,16 +112,19 @@ Transaction::Transaction(int tid, int uid, int bid,
     if (bid <= 0) throw std::invalid_argument("Book ID must be > 0");
 
     // ===== EDGE CASE: Empty checkout date =====
-    if (checkoutDate.empty())
+    if (checkout.empty())
     {
         throw std::invalid_argument("Checkout date cannot be empty");
     }
 
     // ===== EDGE CASE: Empty due date =====
-    if (dueDate.empty())
+    if (due.empty())
     {
         throw std::invalid_argument("Due date cannot be empty");
     }
+
+    checkoutDay = parseDay(checkout, "checkout date");
+    dueDay = parseDay(due, "due date");
 }
 
 /*
@@ -154,9 +136,10 @@ Transaction::Transaction(int tid, int uid, int bid,
                          std::string checkout, std::string due,
                          std::string returned, std::string stat)
     : transactionId(tid), userId(uid), bookId(bid),
-      checkoutDate(std::move(checkout)),
-      dueDate(std::move(due)), returnDate(std::move(returned)),
-      status(std::move(stat))
+      checkoutDay(parseDay(checkout, "checkout date")),
+      dueDay(parseDay(due, "due date")),
+      returnDay(parseDay(returned, "return date")),
+      status(Status::Active)
 {
     // Validation for required fields
     if (tid <= 0) throw std::invalid_argument("Transaction ID must be > 0");
@@ -165,12 +148,26 @@ Transaction::Transaction(int tid, int uid, int bid,
 
     // ===== EDGE CASE: Invalid status =====
     // Status should be one of: "Active", "Returned", "Returned-Late"
-    if (status != "Active" &&
-        status != "Returned" &&
-        status != "Returned-Late")
-    {
-        status = "Active";
-    }
+    // Anything else is treated as "Active"
+    bool known;
+    status = parseStatus(stat, known);
+}
+
+/*
+  Day-number Constructor - For loading from file
+  The loader has already parsed the dates and status
+ */
+Transaction::Transaction(int tid, int uid, int bid,
+                         std::int32_t checkout, std::int32_t due,
+                         std::int32_t returned, Status stat)
+    : transactionId(tid), userId(uid), bookId(bid),
+      checkoutDay(checkout), dueDay(due), returnDay(returned),
+      status(stat)
+{
+    // Validation for required fields
+    if (tid <= 0) throw std::invalid_argument("Transaction ID must be > 0");
+    if (uid <= 0) throw std::invalid_argument("User ID must be > 0");
+    if (bid <= 0) throw std::invalid_argument("Book ID must be > 0");
 }
 
 // ==================== SETTERS ====================
@@ -191,27 +188,27 @@ void Transaction::setBookId(int bid) {
 }
 
 void Transaction::setCheckoutDate(const std::string& date) {
-    checkoutDate = date;
+    checkoutDay = parseDay(date, "checkout date");
 }
 
 void Transaction::setDueDate(const std::string& date) {
-    dueDate = date;
+    dueDay = parseDay(date, "due date");
 }
 
 void Transaction::setReturnDate(const std::string& date) {
-    returnDate = date;
+    returnDay = parseDay(date, "return date");
 }
 
 void Transaction::setStatus(const std::string& s) {
     // ===== EDGE CASE: Invalid status value =====
     // Only accept valid status values
-    if (s != "Active" &&
-        s != "Returned" &&
-        s != "Returned-Late")
+    bool known;
+    Status parsed = parseStatus(s, known);
+    if (!known)
     {
         throw std::invalid_argument("Invalid status value.");
     }
-    status = s;
+    status = parsed;
 }
 
 // ==================== CORE FUNCTIONALITY ====================
@@ -224,63 +221,57 @@ void Transaction::setStatus(const std::string& s) {
  * - Fine = daysLate * $0.50 per day
  *
  * Logic:
- * 1. If book not returned (returnDate empty) -> return 0
- * 2. Parse both dueDate and returnDate
- * 3. Calculate difference: returnDate - dueDate
- * 4. If difference <= 0, book was on time -> return 0
- * 5. If difference > 0, book was late -> return days late
+ * 1. If book not returned (no return date) -> return 0
+ * 2. Calculate difference: returnDay - dueDay (already day numbers)
+ * 3. If difference <= 0, book was on time -> return 0
+ * 4. If difference > 0, book was late -> return days late
  *
  * Edge Cases:
  * 1. returnDate empty (still active) -> returns 0
  * 2. returnDate == dueDate (on time) -> returns 0
  * 3. returnDate < dueDate (early) -> returns 0
- * 4. Invalid date formats -> returns 0 (safe default)
+ * 4. Missing due date -> returns 0 (safe default)
  *
  * @return Number of days late (0 if on time or still active)
  */
 
 int Transaction::calculateDaysLate() const
 {
-    // ===== EDGE CASE: Book not returned yet =====
-    // If returnDate is empty, the book hasn't been returned
-    // No late fee until it's actually returned
-    if (returnDate.empty()) return 0;
-
-    // Parse due date into components
-    int dueYear, dueMonth, dueDay;
-    bool dueParsed = parseDateToComponents(dueDate, dueYear, dueMonth, dueDay);
-
-    // Parse return date into components
-    int retYear, retMonth, retDay;
-    bool retParsed = parseDateToComponents(returnDate, retYear, retMonth, retDay);
-
-    // ===== EDGE CASE: Invalid date format =====
-    // If we can't parse the dates, we can't calculate lateness
-    // Return 0 as a safe default
-    if (!dueParsed || !retParsed)
-    {
-        std::cerr << "[WARNING] Could not parse dates for transaction "
-                  << transactionId << ". Due: " << dueDate
-                  << ", Return: " << returnDate << "\n";
-        return 0;
-    }
-
-    // Convert both dates to "total days" for easy comparison
-    int dueDays = dateToDays(dueYear, dueMonth, dueDay);
-    int returnDays = dateToDays(retYear, retMonth, retDay);
+    // ===== EDGE CASE: Book not returned yet / no due date =====
+    // No late fee until the book is actually returned
+    if (returnDay == NO_DATE || dueDay == NO_DATE) return 0;
 
-    // Calculate the difference
-    int daysLate = returnDays - dueDays;
+    // Both dates are day numbers, so the difference is exact
+    // (month lengths and leap years are already accounted for)
+    int daysLate = returnDay - dueDay;
 
     // ===== EDGE CASE: Book returned on time or early =====
-    // If daysLate is 0 or negative, the book was not late
-    if (daysLate <= 0)
-    {
-        return 0;
-    }
+    return daysLate > 0 ? daysLate : 0;
+}
 
-    // Book was late - return the number of days
-    return daysLate;
+/**
+ * calculateDaysLate (batch) - calculateDaysLate() for n records at once
+ *
+ * A record is 28 bytes, a stride compilers won't vectorize, so the two
+ * day numbers are copied into small column buffers block by block and
+ * Date::daysLate computes each block in one branch-free SIMD pass.
+ */
+void Transaction::calculateDaysLate(const Transaction* records, std::size_t n,
+                                    std::int32_t* out)
+{
+    const std::size_t BLOCK = 256;
+    std::int32_t due[BLOCK];
+    std::int32_t returned[BLOCK];
+
+    for (std::size_t start = 0; start < n; start += BLOCK) {
+        std::size_t count = std::min(BLOCK, n - start);
+
+        for (std::size_t i = 0; i < count; ++i) {
+            due[i] = records[start + i].dueDay;
+            returned[i] = records[start + i].returnDay;
+        }
+        Date::daysLate(due, returned, count, NO_DATE, out + start);
+    }
 }
 
 /**
@@ -294,7 +285,7 @@ int Transaction::calculateDaysLate() const
  * @param returnDateStr - The date of return (format: "YYYY-MM-DD")
  *
  * Edge Cases:
- * - Empty return date -> throws invalid_argument
+ * - Empty or invalid return date -> throws invalid_argument
  * - Already returned -> throws runtime_error
  */
 void Transaction::completeReturn(const std::string& returnDateStr)
@@ -305,16 +296,16 @@ void Transaction::completeReturn(const std::string& returnDateStr)
 
     // ===== EDGE CASE: Already returned =====
     // Cannot return a book that's already been returned
-    if (status != "Active")
+    if (status != Status::Active)
         throw std::runtime_error("Transaction already completed.");
 
-    // Set the return date
-    returnDate = returnDateStr;
+    // Set the return date (throws before changing anything if invalid)
+    returnDay = parseDay(returnDateStr, "return date");
 
     // Calculate if it's late and set appropriate status
     int daysLate = calculateDaysLate();
 
-    status = (daysLate > 0 ? "Returned-Late" : "Returned");
+    status = (daysLate > 0 ? Status::ReturnedLate : Status::Returned);
 }
 
 /*
@@ -327,20 +318,20 @@ void Transaction::display() const
     std::cout << "Transaction ID: " << transactionId << "\n";
     std::cout << "User ID: " << userId << "\n";
     std::cout << "Book ID: " << bookId << "\n";
-    std::cout << "Checkout Date: " << checkoutDate << "\n";
-    std::cout << "Due Date: " << dueDate << "\n";
+    std::cout << "Checkout Date: " << getCheckoutDate() << "\n";
+    std::cout << "Due Date: " << getDueDate() << "\n";
 
     // Show return date only if book has been returned
-    if (returnDate.empty()) {
+    if (returnDay == NO_DATE) {
         std::cout << "Return Date: (Not returned)\n";
     } else {
-        std::cout << "Return Date: " << returnDate << "\n";
+        std::cout << "Return Date: " << getReturnDate() << "\n";
         int late = calculateDaysLate();
         if (late > 0)
             std::cout << "Days Late: " << late << "\n";
     }
 
-    std::cout << "Status: " << status << "\n";
+    std::cout << "Status: " << getStatus() << "\n";
     std::cout << "========================================\n";
 }
 
@@ -353,8 +344,8 @@ std::string Transaction::toCSV() const
     return std::to_string(transactionId) + "," +
            std::to_string(userId) + "," +
            std::to_string(bookId) + "," +
-           checkoutDate + "," +
-           dueDate + "," +
-           returnDate + "," +
-           status;
+           getCheckoutDate() + "," +
+           getDueDate() + "," +
+           getReturnDate() + "," +
+           getStatus();
 }
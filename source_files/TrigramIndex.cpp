@@ -0,0 +1,156 @@
+/*
+ TrigramIndex.cpp
+ Implementation file for the TrigramIndex class (substring search filter).
+*/
+
+#include "TrigramIndex.h"
+#include <algorithm>
+#include <cctype>
+
+// ==================== TRIGRAM EXTRACTION ====================
+
+static std::uint32_t foldByte(char c) {
+    return static_cast<std::uint32_t>(
+        std::tolower(static_cast<unsigned char>(c)));
+}
+
+std::vector<std::uint32_t> TrigramIndex::trigramsOf(std::string_view a,
+                                                    std::string_view b,
+                                                    std::string_view c)
+{
+    std::vector<std::uint32_t> grams;
+
+    for (std::string_view s : { a, b, c }) {
+        for (std::size_t i = 0; i + 3 <= s.size(); ++i) {
+            grams.push_back(foldByte(s[i]) << 16 |
+                            foldByte(s[i + 1]) << 8 |
+                            foldByte(s[i + 2]));
+        }
+    }
+
+    std::sort(grams.begin(), grams.end());
+    grams.erase(std::unique(grams.begin(), grams.end()), grams.end());
+    return grams;
+}
+
+// ==================== INDEX MAINTENANCE ====================
+
+void TrigramIndex::addBook(int bookId, std::string_view title,
+                           std::string_view author, std::string_view isbn)
+{
+    for (std::uint32_t g : trigramsOf(title, author, isbn)) {
+        std::vector<int>& list = postings[g];
+
+        // New books get increasing IDs, so appending is the common case
+        if (list.empty() || list.back() < bookId) {
+            list.push_back(bookId);
+            continue;
+        }
+
+        auto pos = std::lower_bound(list.begin(), list.end(), bookId);
+        if (pos == list.end() || *pos != bookId)
+            list.insert(pos, bookId);
+    }
+}
+
+void TrigramIndex::removeBook(int bookId, std::string_view title,
+                              std::string_view author, std::string_view isbn)
+{
+    for (std::uint32_t g : trigramsOf(title, author, isbn)) {
+        auto it = postings.find(g);
+        if (it == postings.end()) continue;
+
+        std::vector<int>& list = it->second;
+        auto pos = std::lower_bound(list.begin(), list.end(), bookId);
+        if (pos != list.end() && *pos == bookId)
+            list.erase(pos);
+
+        if (list.empty())
+            postings.erase(it);
+    }
+}
+
+void TrigramIndex::clear() {
+    postings.clear();
+}
+
+// ==================== QUERY ====================
+
+bool TrigramIndex::candidates(const std::string& query,
+                              std::vector<int>& out,
+                              std::size_t maxCandidates) const
+{
+    out.clear();
+
+    // ===== EDGE CASE: Query shorter than a trigram =====
+    if (query.size() < MIN_QUERY_LENGTH) return false;
+
+    std::vector<const std::vector<int>*> lists;
+    for (std::uint32_t g : trigramsOf(query)) {
+        auto it = postings.find(g);
+
+        // No book has this trigram, so no book contains the query
+        if (it == postings.end()) return true;
+
+        lists.push_back(&it->second);
+    }
+
+    // Intersect from the rarest trigram upwards
+    std::sort(lists.begin(), lists.end(),
+              [](const std::vector<int>* x, const std::vector<int>* y) {
+                  return x->size() < y->size();
+              });
+
+    // ===== EDGE CASE: Broad query, even the rarest trigram is common =====
+    // The intersection can't be larger than the rarest list, so this caps
+    // both the copy below and the caller's work on the result
+    if (lists[0]->size() > maxCandidates) return false;
+
+    out = *lists[0];
+
+    for (std::size_t i = 1; i < lists.size() && !out.empty(); ++i) {
+        const std::vector<int>& list = *lists[i];
+        auto from = list.begin();
+        std::size_t kept = 0;
+
+        for (int id : out) {
+            from = std::lower_bound(from, list.end(), id);
+            if (from == list.end()) break;
+            if (*from == id)
+                out[kept++] = id;
+        }
+        out.resize(kept);
+    }
+
+    return true;
+}
+
+bool TrigramIndex::fuzzyCandidates(const std::string& query, int maxEdits,
+                                   std::vector<int>& out) const
+{
+    out.clear();
+
+    std::vector<std::uint32_t> grams = trigramsOf(query);
+    long minShared = static_cast<long>(grams.size()) - 3L * maxEdits;
+
+    // ===== EDGE CASE: Too many edits allowed for the filter to prune =====
+    if (minShared <= 0) return false;
+
+    // Gather every posting, then keep books listed at least minShared times
+    std::vector<int> hits;
+    for (std::uint32_t g : grams) {
+        auto it = postings.find(g);
+        if (it != postings.end())
+            hits.insert(hits.end(), it->second.begin(), it->second.end());
+    }
+    std::sort(hits.begin(), hits.end());
+
+    for (std::size_t i = 0; i < hits.size();) {
+        std::size_t j = i;
+        while (j < hits.size() && hits[j] == hits[i]) ++j;
+        if (static_cast<long>(j - i) >= minShared)
+            out.push_back(hits[i]);
+        i = j;
+    }
+    return true;
+}
@@ -4,8 +4,10 @@
 #include <iostream>
 
 FileManager::FileManager(const std::string& books,
-                         const std::string& trans)
-    : booksfile(books), transfile(trans) {}
+                         const std::string& trans,
+                         const std::string& fines,
+                         const std::string& snap)
+    : booksfile(books), transfile(trans), finesfile(fines), snapfile(snap) {}
 
 bool FileManager::exists(const std::string& file) {
     std::ifstream f(file);
@@ -23,17 +25,21 @@ void FileManager::loaddata() {
         std::cout << "transactions file not found\n";
         return;
     }
+    // fines file is optional (older data has none), start with no fines
+    if (!exists(finesfile)) {
+        std::cout << "fines file not found, starting with no fines\n";
+    }
 
-    // load using library functions
-    Library::instance().loadFromCSV(booksfile, transfile);
+    // load using library functions (snapshot if current, else CSV)
+    Library::instance().load(booksfile, transfile, finesfile, snapfile);
 
     std::cout << "data loaded\n";
 }
 
 void FileManager::savedata() {
 
-    // save using library functions
-    Library::instance().saveToCSV(booksfile, transfile);
+    // save using library functions (CSV, then a matching snapshot)
+    Library::instance().save(booksfile, transfile, finesfile, snapfile);
 
     std::cout << "data saved\n";
 }
@@ -7,8 +7,9 @@
 #include <limits>
 
 int main() {
-    // Load persisted data (books and transactions) from CSV
-    Library::instance().loadFromCSV();
+    // Load persisted data (books, transactions and fines): the binary
+    // snapshot when it matches the CSV files, otherwise the CSV files
+    Library::instance().load();
 
     // Create example users for demonstration purposes
     // Constructor params: (userID, name, email, userType, membershipDate)
@@ -45,7 +46,7 @@ int main() {
             case 3: member.menu(); break;      // Member menu
             case 4: guest.menu(); break;       // Non-member menu
             case 5:                           // Exit option
-                Library::instance().saveToCSV(); // Save current data to CSV
+                Library::instance().save(); // Save current data to CSV and snapshot
                 std::cout << "Goodbye\n";
                 return 0;
             default: